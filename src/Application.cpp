@@ -1,9 +1,12 @@
-#include <thread>
 #include "Application.h"
 #include "service/TimeUpdateService.h"
 #include "service/WeatherApiService.h"
 #include "system/TerminationService.h"
 
+#ifdef INPUT_GPIO
+    #include "input/InputManager.h"
+    #include "input/InputRecorder.h"
+#endif
 #ifdef SENSOR_BME280
     #include "service/BME280Service.h"
 #endif
@@ -26,9 +29,14 @@ namespace PiAlarm {
         std::chrono::minutes snoozeDuration,
         std::chrono::minutes ringDuration,
         const std::string& weatherCityName,
-        const std::filesystem::path &customMusicFolderPath
+        const std::filesystem::path &customMusicFolderPath,
+        [[maybe_unused]] const std::filesystem::path &inputRecordPath
     )
         : HasLogger("Application"),
+        // main loop
+        eventLoop{},
+        uiQueue{eventLoop}, // wakes the loop up when a notification is queued
+
         // model
         clock_data{},
         alarms_data{alarmCount},
@@ -37,7 +45,7 @@ namespace PiAlarm {
         co2_data{},
 
         // manager
-        alarmManager{clock_data, alarms_data, snoozeDuration, ringDuration},
+        alarmManager{clock_data, alarms_data, snoozeDuration, ringDuration, &uiQueue}, // the alarm logic and sound run on the main loop
         alarmState{alarmManager.getAlarmState()}, // Current state of the alarm, retrieved from the AlarmManager
 
         // controller
@@ -50,7 +58,11 @@ namespace PiAlarm {
 
         // display
         renderer{std::make_unique<gfx::SDD1322Buffer>()},
+    #ifdef DISPLAY_HEADLESS
+        screen{}, // in-memory stand-in of the SSD1322 display
+    #else
         screen{hardware::GPIOConfig{25}, hardware::GPIOConfig{24}}, // SSD1322 OLED display
+    #endif
 
 #elif defined(DISPLAY_CONSOLE)
 
@@ -60,23 +72,31 @@ namespace PiAlarm {
 
 #endif // DISPLAY_SSD1322 DISPLAY_CONSOLE
 
+        // input latency
+        inputLatency{},
+
         // view
-        viewManager{screen, renderer},
+        viewManager{screen, renderer, inputLatency},
 
 #ifdef INPUT_GPIO
 
-        // input manager
-        inputManager{
-            {
+        // input source
+        inputSource{
+            std::make_unique<input::InputManager>(std::vector<input::InputManager::ButtonConfig>{
                 {hardware::GPIOConfig{13}, input::ButtonId::Main, false},
                 {hardware::GPIOConfig{12}, input::ButtonId::Back, true},
                 {hardware::GPIOConfig{6}, input::ButtonId::Next, true},
                 {hardware::GPIOConfig{5}, input::ButtonId::Previous, true}
-            }
+            })
         },
+        inputRecordPath{inputRecordPath},
 
 #endif // INPUT_GPIO
 
+        // services
+        serviceScheduler{},
+        coroutineExecutor{},
+
         // media
         musicService{customMusicFolderPath, "assets/default_alarm"},
 
@@ -92,40 +112,76 @@ namespace PiAlarm {
         initInputs();
         initServices();
         initViews();
+        initEventLoop();
     }
 
     void Application::run() {
         startServices();
+        viewManager.start();
+
+        #ifdef INPUT_GPIO
+            inputWorker->startWorker();
+        #endif
 
         while (running_.load()) {
             #ifdef INPUT_GPIO
 
-                auto events {inputManager.pollEvents()};
-                for (const auto& event : events) {
+                // Events read by the input thread, which notifies the event loop when it queues some
+                inputWorker->drainEvents([this](const input::InputEvent& event) {
                     handleInputEvent(event);
-                }
+                });
 
             #endif // INPUT_GPIO
 
+            // Model changes of the other threads, e.g. the clock tick driving the alarm manager
+            uiQueue.drain();
+
             viewManager.refresh();
-            std::this_thread::sleep_for(std::chrono::milliseconds(170));
+
+            // Sleep until an input is queued, a model changes or the next second starts
+            eventLoop.wait();
         }
 
+        #ifdef INPUT_GPIO
+            inputWorker->stop();
+        #endif
+        viewManager.stop();
         stopServices();
+        logDisplayTiming();
+        inputLatency.logSummary();
+        common::CycleStats::logAll(logger());
     }
 
     void Application::initSignalHandler() {
         system::TerminationService::initialize();
         system::TerminationService::register_hook([this] {
             running_.store(false);
+            eventLoop.notify(); // leave the wait of the main loop
         });
     }
 
+    void Application::initEventLoop() {
+        // Registered after the views, which mark themselves dirty before the loop wakes up to refresh them
+        clock_data.addObserver(&eventLoop);
+        alarms_data.addObserver(&eventLoop);
+        alarmState.addObserver(&eventLoop);
+        currentWeather_data.addObserver(&eventLoop);
+        currentIndoor_data.addObserver(&eventLoop);
+        co2_data.addObserver(&eventLoop);
+    }
+
     void Application::initInputs() {
         #ifdef INPUT_GPIO
 
         try {
-            inputManager.init();
+            if (!inputRecordPath.empty()) {
+                // Write the session to a script, ReplayInputSource can play it back without the buttons
+                inputSource = std::make_unique<input::InputRecorder>(std::move(inputSource), inputRecordPath);
+                logger().info("Recording input events to {}", inputRecordPath.string());
+            }
+
+            inputSource->init();
+            inputWorker = std::make_unique<input::InputWorker>(*inputSource, eventLoop);
         } catch (const std::exception& e) {
             logger().error("Failed to initialize input manager: {}", e.what());
             throw;
@@ -135,27 +191,33 @@ namespace PiAlarm {
     }
 
     void Application::initServices() {
-        services.emplace_back(std::make_unique<service::TimeUpdateService>(clock_data));
-        services.emplace_back(std::make_unique<service::WeatherApiService>(currentWeather_data, weatherCityName));
+        services.emplace_back(std::make_unique<service::TimeUpdateService>(coroutineExecutor, clock_data));
+        services.emplace_back(std::make_unique<service::WeatherApiService>(serviceScheduler, currentWeather_data, weatherCityName));
 
         #ifdef SENSOR_BME280
-            services.emplace_back(std::make_unique<service::BME280Service>(currentIndoor_data));
+            services.emplace_back(std::make_unique<service::BME280Service>(coroutineExecutor, currentIndoor_data));
         #endif
         #ifdef SENSOR_SCD41
-            services.emplace_back(std::make_unique<service::SCD41Service>(co2_data, currentIndoor_data));
+            services.emplace_back(std::make_unique<service::SCD41Service>(coroutineExecutor, co2_data, currentIndoor_data));
         #endif
     }
 
-    void Application::startServices() const {
+    void Application::startServices() {
+        serviceScheduler.start();
+        coroutineExecutor.start();
+
         for (auto& service : services) {
             service->start();
         }
     }
 
-    void Application::stopServices() const {
+    void Application::stopServices() {
         for (auto& service : services) {
             service->stop();
         }
+
+        serviceScheduler.stop();
+        coroutineExecutor.stop();
     }
 
     void Application::initViews() {
@@ -200,9 +262,31 @@ namespace PiAlarm {
         #endif // DISPLAY_SSD1322 DISPLAY_CONSOLE
     }
 
+    void Application::logDisplayTiming() {
+        #ifdef DISPLAY_SSD1322
+
+            const auto& timing = screen.getFlushTiming();
+            if (timing.flushes == 0) return;
+
+            using Microseconds = std::chrono::duration<double, std::micro>;
+            logger().info(
+                "Display flushes: {}, average {:.1f} us (line rate minimum {:.1f} us), max {:.1f} us, {:.1f} bytes and {:.2f} SPI ioctls per flush",
+                timing.flushes,
+                Microseconds{timing.total}.count() / timing.flushes,
+                Microseconds{timing.lineTime}.count() / timing.flushes,
+                Microseconds{timing.max}.count(),
+                static_cast<double>(timing.bytes) / timing.flushes,
+                static_cast<double>(timing.messages) / timing.flushes
+            );
+
+        #endif // DISPLAY_SSD1322
+    }
+
 #ifdef INPUT_GPIO
 
     void Application::handleInputEvent(const input::InputEvent& event) {
+        inputLatency.record(common::InputLatencyTracer::Stage::Dispatched, event.timestamp);
+
         auto eventConsumed = handleAlarmControlInput(event);
         if (eventConsumed) return; // If the event was consumed by the alarm control, do not propagate further
 
@@ -211,7 +295,7 @@ namespace PiAlarm {
 
     bool Application::handleAlarmControlInput(const input::InputEvent& event) {
         if (!alarmState.hasTriggeredAlarm()) {
-            if (backButtonPressedCount) backButtonPressedCount = 0; // Reset back button count if no alarm is active
+            backButtonPressTime.reset(); // Forget the back button press if no alarm is active
 
             return false; // No alarm is currently active, ignore the event
         }
@@ -226,14 +310,16 @@ namespace PiAlarm {
 
             case input::ButtonId::Back:
                 if (event.pressed) {
-                    ++backButtonPressedCount;
+                    if (!backButtonPressTime) backButtonPressTime = event.timestamp; // press edge, the next events are repeats
 
-                    if (backButtonPressedCount >= BACK_BUTTON_LONG_PRESS_COUNT) {
+                    // Measured between the press edge and the repeat, not when the events are handled
+                    if (event.timestamp - *backButtonPressTime >= BACK_BUTTON_LONG_PRESS_DURATION) {
+                        backButtonPressTime.reset();
                         alarmController.stopAlarm();
                         return true;
                     }
                 }else {
-                    backButtonPressedCount = 0; // Reset count on release
+                    backButtonPressTime.reset(); // Reset on release
                 }
                 break;
 
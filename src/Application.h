@@ -1,5 +1,8 @@
 #pragma once
 
+#include "common/CycleStats.h"
+#include "common/InputLatencyTracer.h"
+#include "common/NotificationQueue.h"
 #include "controller/AlarmController.h"
 #include "display/ViewOutputConfig.h"
 #include "logging/HasLogger.h"
@@ -10,16 +13,22 @@
 #include "model/CurrentIndoorData.hpp"
 #include "model/CurrentWeatherData.h"
 #include "model/manager/AlarmManager.h"
+#include "service/CoroutineExecutor.h"
 #include "service/IService.h"
+#include "service/ServiceScheduler.h"
+#include "system/EventLoop.h"
 #include "trigger/AlarmSoundTrigger.h"
 #include "view/manager/ViewManager.h"
 
 #include <atomic>
+#include <chrono>
+#include <optional>
 #include <vector>
 #include <memory>
 
 #ifdef INPUT_GPIO
-    #include "input/InputManager.h"
+    #include "input/IInputSource.h"
+    #include "input/InputWorker.h"
     #include "input/HasInputEventHandler.h"
 #endif
 
@@ -44,7 +53,7 @@ namespace PiAlarm {
         , public input::HasInputEventHandler // Inherit from HasInputEventHandler to handle input events
 #endif
     {
-        static constexpr int BACK_BUTTON_LONG_PRESS_COUNT {4}; ///< Number of back button repeat event to trigger a long press action
+        static constexpr auto BACK_BUTTON_LONG_PRESS_DURATION {std::chrono::milliseconds(700)}; ///< Holding time of the back button to trigger a long press action
 
         std::atomic<bool> running_ {true}; ///< Atomic flag to control the main application loop
 
@@ -61,13 +70,15 @@ namespace PiAlarm {
          * @param ringDuration The duration for alarm ringing (default is 60 minutes)
          * @param weatherCityName The city name for weather data retrieval (default is "Brussel-1") (see provider::WeatherApiClient::WeatherApiClient for available cities)
          * @param customMusicFolderPath Path to a custom folder for alarm sounds (default is empty string (The alarmService will use the app default music folder))
+         * @param inputRecordPath Path of a script to record the button events to, for a later replay (default is empty string (no recording)). Only used with INPUT_GPIO
          */
         explicit Application(
             size_t alarmCount = 3,
             std::chrono::minutes snoozeDuration = std::chrono::minutes(5),
             std::chrono::minutes ringDuration = std::chrono::minutes(60),
             const std::string &weatherCityName = "Brussel-1",
-            const std::filesystem::path &customMusicFolderPath = ""
+            const std::filesystem::path &customMusicFolderPath = "",
+            const std::filesystem::path &inputRecordPath = ""
         );
 
         /**
@@ -83,6 +94,14 @@ namespace PiAlarm {
          */
         void run();
 
+        /**
+         * @brief Gives access to the input latency histograms.
+         * They can be read while the application runs, and are logged when it stops.
+         * @return The tracer of the input latency, from the button edge to the screen.
+         */
+        [[nodiscard]]
+        inline const common::InputLatencyTracer& getInputLatency() const;
+
 #ifdef INPUT_GPIO
 
         /**
@@ -117,10 +136,16 @@ namespace PiAlarm {
         void initSignalHandler();
 
         /**
-         * @brief Initializes the input manager and sets up input event handling.
+         * @brief Initializes the input source and creates the worker thread polling it.
          */
         void initInputs();
 
+        /**
+         * @brief Sets up what wakes the main loop up: model changes (the input thread notifies the loop itself).
+         * Called once the views are created, so they are notified of a model change before the loop wakes up.
+         */
+        void initEventLoop();
+
         /**
          * @brief Initializes the services for the application.
          */
@@ -129,12 +154,12 @@ namespace PiAlarm {
         /**
          * @brief Starts all services required by the application.
          */
-        void startServices() const;
+        void startServices();
 
         /**
          * @brief Stops all services gracefully.
          */
-        void stopServices() const;
+        void stopServices();
 
         /**
          * @brief Initializes the views for the application.
@@ -144,9 +169,19 @@ namespace PiAlarm {
          */
         void initViews();
 
+        /**
+         * @brief Logs the measured flush durations of the display.
+         * Called at shutdown, to compare the time spent flushing with the SPI line rate.
+         */
+        void logDisplayTiming();
+
 
         // Definition of types used in the application
 
+        // main loop
+        system::EventLoop eventLoop;                            ///< Wakes the main loop up when there is work, outlives the observed models
+        common::NotificationQueue uiQueue;                      ///< Model notifications run by the main loop instead of the thread changing the model
+
         // model
         model::ClockData clock_data;                            ///< Clock data model
         model::AlarmsData alarms_data;                          ///< Alarms data model
@@ -174,20 +209,27 @@ namespace PiAlarm {
         ScreenType& screen;                                     ///< Reference to the console output stream
 #endif
 
+        // input latency
+        common::InputLatencyTracer inputLatency;                ///< Latency of the inputs, from the button edge to the screen
+
         // view manager
         view::ViewManager viewManager;                          ///< Manages the views in the application
 
 #ifdef INPUT_GPIO
 
-        // input manager
-        input::InputManager inputManager;                       ///< Manages user input events
+        // input source
+        std::unique_ptr<input::IInputSource> inputSource;       ///< Source of the user input events, the GPIO buttons
+        std::filesystem::path inputRecordPath;                  ///< Script the input events are recorded to, empty for no recording
+        std::unique_ptr<input::InputWorker> inputWorker;        ///< Polls the input source on its own thread, created once the source is initialized
 
         // input event state
-        unsigned backButtonPressedCount = 0;                    ///< Counter for back button presses. Used to handle long presses
+        std::optional<std::chrono::steady_clock::time_point> backButtonPressTime; ///< Time the back button was pressed, if held. Used to handle long presses
 
 #endif // INPUT_GPIO
 
         // services
+        service::ServiceScheduler serviceScheduler;             ///< Runs the cycles of the blocking services on a shared pool of threads, outlives the services
+        service::CoroutineExecutor coroutineExecutor;           ///< Runs the coroutine services (clock tick, sensors) on a single thread, outlives the services
         std::vector<std::unique_ptr<service::IService>> services; ///< Vector to hold pointers to all services for easy management
 
         // media
@@ -197,4 +239,10 @@ namespace PiAlarm {
         trigger::AlarmSoundTrigger alarmSoundTrigger;           ///< Trigger to manage alarm sounds based on the alarm state
     };
 
+    // Inline methods implementation
+
+    inline const common::InputLatencyTracer& Application::getInputLatency() const {
+        return inputLatency;
+    }
+
 } // namespace PiAlarm
\ No newline at end of file
@@ -0,0 +1,110 @@
+#include <algorithm>
+#include <exception>
+
+#include "CycleStats.h"
+
+#ifndef CYCLE_BUDGET_MS
+    #define CYCLE_BUDGET_MS 0
+#endif
+
+namespace PiAlarm::common {
+
+    CycleStats::CycleStats(std::string name, Duration budget)
+        : name_{std::move(name)}, budget_{budget.count()}
+    {
+        std::lock_guard lock{registryMutex_};
+        registry_.push_back(this);
+    }
+
+    CycleStats::~CycleStats() {
+        std::lock_guard lock{registryMutex_};
+        std::erase(registry_, this);
+    }
+
+    bool CycleStats::recordProcess(Duration duration, spdlog::logger& logger) {
+        process_.record(duration);
+
+        const Duration budget = getBudget();
+        if (budget <= Duration::zero() || duration <= budget) return false;
+
+        overruns_.fetch_add(1, std::memory_order_relaxed);
+
+        using Milliseconds = std::chrono::duration<double, std::milli>;
+        logger.warn("Cycle took {:.2f} ms, over the budget of {:.0f} ms",
+            Milliseconds{duration}.count(), Milliseconds{budget}.count());
+        return true;
+    }
+
+    void CycleStats::recordException(spdlog::logger& logger) {
+        exceptions_.fetch_add(1, std::memory_order_relaxed);
+
+        try {
+            throw; // the exception being handled by the caller
+        }
+        catch (const std::exception& e) {
+            logger.error("Exception caught during cycle: {}", e.what());
+        }
+        catch (...) {
+            logger.error("Unknown exception caught during cycle.");
+        }
+    }
+
+    CycleStats::Snapshot CycleStats::snapshot() const {
+        return Snapshot{
+            .name = name_,
+            .process = process_.summarize(),
+            .wait = wait_.summarize(),
+            .lateness = lateness_.summarize(),
+            .exceptions = exceptions_.load(std::memory_order_relaxed),
+            .overruns = overruns_.load(std::memory_order_relaxed),
+            .budget = getBudget()
+        };
+    }
+
+    std::vector<CycleStats::Snapshot> CycleStats::listAll() {
+        std::lock_guard lock{registryMutex_};
+
+        std::vector<Snapshot> snapshots;
+        snapshots.reserve(registry_.size());
+        for (const CycleStats* stats : registry_) {
+            snapshots.push_back(stats->snapshot());
+        }
+        return snapshots;
+    }
+
+    void CycleStats::logAll(spdlog::logger& logger) {
+        using Milliseconds = std::chrono::duration<double, std::milli>;
+
+        for (const Snapshot& stats : listAll()) {
+            if (stats.process.count == 0) continue;
+
+            logger.info(
+                "{}: {} cycles, process mean {:.2f} ms, p99 {:.2f} ms, max {:.2f} ms, {} over {:.0f} ms budget, {} exceptions",
+                stats.name,
+                stats.process.count,
+                Milliseconds{stats.process.mean}.count(),
+                Milliseconds{stats.process.p99}.count(),
+                Milliseconds{stats.process.max}.count(),
+                stats.overruns,
+                Milliseconds{stats.budget}.count(),
+                stats.exceptions
+            );
+
+            if (stats.lateness.count > 0) {
+                logger.info(
+                    "{}: wait mean {:.2f} ms, wake-up lateness p50 {:.2f} ms, p99 {:.2f} ms, max {:.2f} ms",
+                    stats.name,
+                    Milliseconds{stats.wait.mean}.count(),
+                    Milliseconds{stats.lateness.p50}.count(),
+                    Milliseconds{stats.lateness.p99}.count(),
+                    Milliseconds{stats.lateness.max}.count()
+                );
+            }
+        }
+    }
+
+    CycleStats::Duration CycleStats::getDefaultBudget() {
+        return std::chrono::milliseconds{CYCLE_BUDGET_MS};
+    }
+
+} // namespace PiAlarm::common
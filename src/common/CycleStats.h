@@ -0,0 +1,166 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <spdlog/spdlog.h>
+
+#include "LatencyHistogram.h"
+
+namespace PiAlarm::common {
+
+    /**
+     * @class CycleStats
+     * @brief Timing of the cycles of a worker or a service, recorded and read from any thread without locking.
+     *
+     * Each cycle records how long its process took, how long it waited before the next cycle,
+     * and how late it woke up against the time it asked for. Exceptions escaping a cycle are counted,
+     * as are the cycles whose process took longer than the budget.
+     * Every instance is listed in a registry while it lives, so the stats of all workers can be queried at once.
+     */
+    class CycleStats {
+    public:
+        using Duration = LatencyHistogram::Duration; ///< Resolution of the recorded durations
+
+        /**
+         * @struct Snapshot
+         * @brief Statistics of the cycles recorded so far.
+         */
+        struct Snapshot {
+            std::string name; ///< Name of the worker or service
+            LatencyHistogram::Summary process; ///< Duration of the process of a cycle
+            LatencyHistogram::Summary wait; ///< Duration of the wait between two cycles
+            LatencyHistogram::Summary lateness; ///< Delay between the requested wake-up time and the actual one
+            uint64_t exceptions {0}; ///< Number of exceptions escaped from a cycle
+            uint64_t overruns {0}; ///< Number of processes longer than the budget
+            Duration budget {}; ///< Budget of a process, zero if none
+        };
+
+    private:
+        const std::string name_; ///< Name of the worker or service
+
+        LatencyHistogram process_ {}; ///< Duration of the processes
+        LatencyHistogram wait_ {}; ///< Duration of the waits
+        LatencyHistogram lateness_ {}; ///< Lateness of the wake-ups
+        std::atomic<uint64_t> exceptions_ {0}; ///< Number of exceptions
+        std::atomic<uint64_t> overruns_ {0}; ///< Number of processes longer than the budget
+        std::atomic<Duration::rep> budget_; ///< Budget of a process in nanoseconds, zero if none
+
+        inline static std::mutex registryMutex_ {}; ///< Mutex guarding registry_
+        inline static std::vector<const CycleStats*> registry_ {}; ///< Every living instance
+
+    public:
+
+        /**
+         * @brief Constructs empty stats and registers them.
+         * @param name The name of the worker or service.
+         * @param budget The budget of a process, zero for none. Defaults to the CYCLE_BUDGET_MS build option.
+         */
+        explicit CycleStats(std::string name, Duration budget = getDefaultBudget());
+
+        /**
+         * @brief Unregisters the stats.
+         */
+        ~CycleStats();
+
+        CycleStats(const CycleStats&) = delete; ///< No copy constructor
+        CycleStats& operator=(const CycleStats&) = delete; ///< No copy assignment operator
+
+        /**
+         * @brief Records the duration of a process, and warns if it is longer than the budget.
+         * @param duration The duration.
+         * @param logger The logger of the worker or service, warned of an overrun.
+         * @return True if it is longer than the budget, which is then counted as an overrun.
+         */
+        bool recordProcess(Duration duration, spdlog::logger& logger);
+
+        /**
+         * @brief Records the duration of a wait between two cycles.
+         * @param duration The duration.
+         */
+        inline void recordWait(Duration duration);
+
+        /**
+         * @brief Records how late a wait ended against the time it asked for.
+         * @param lateness The delay, a wait ending early is counted as zero.
+         */
+        inline void recordLateness(Duration lateness);
+
+        /**
+         * @brief Counts an exception escaped from a cycle, and logs it as an error.
+         * Must be called from the catch block handling the exception.
+         * @param logger The logger of the worker or service.
+         */
+        void recordException(spdlog::logger& logger);
+
+        /**
+         * @brief Sets the budget of a process.
+         * @param budget The budget, zero for none.
+         */
+        inline void setBudget(Duration budget);
+
+        /**
+         * @brief Gets the budget of a process.
+         * @return The budget, zero if none.
+         */
+        [[nodiscard]]
+        inline Duration getBudget() const;
+
+        /**
+         * @brief Gets the name of the worker or service.
+         * @return The name.
+         */
+        [[nodiscard]]
+        const std::string& getName() const { return name_; }
+
+        /**
+         * @brief Computes the statistics of the cycles recorded so far.
+         * @return The snapshot.
+         */
+        [[nodiscard]]
+        Snapshot snapshot() const;
+
+        /**
+         * @brief Computes the statistics of every living instance.
+         * @return The snapshots, in creation order.
+         */
+        [[nodiscard]]
+        static std::vector<Snapshot> listAll();
+
+        /**
+         * @brief Logs the process, wait and lateness statistics of every instance that ran at least one cycle.
+         * @param logger The logger to write to.
+         */
+        static void logAll(spdlog::logger& logger);
+
+        /**
+         * @brief Gets the default budget of a process, set at build time by the CYCLE_BUDGET_MS option.
+         * @return The budget, zero if none.
+         */
+        [[nodiscard]]
+        static Duration getDefaultBudget();
+    };
+
+    // Inline methods implementation
+
+    inline void CycleStats::recordWait(Duration duration) {
+        wait_.record(duration);
+    }
+
+    inline void CycleStats::recordLateness(Duration lateness) {
+        lateness_.record(lateness);
+    }
+
+    inline void CycleStats::setBudget(Duration budget) {
+        budget_.store(budget.count(), std::memory_order_relaxed);
+    }
+
+    inline CycleStats::Duration CycleStats::getBudget() const {
+        return Duration{budget_.load(std::memory_order_relaxed)};
+    }
+
+} // namespace PiAlarm::common
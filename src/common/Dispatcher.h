@@ -0,0 +1,36 @@
+#pragma once
+
+#include "Observer.h"
+
+namespace PiAlarm::common {
+
+    /**
+     * @interface Dispatcher
+     * @brief Delivers the notifications of an Observable to an observer on another thread than the one of the change.
+     *
+     * An observer subscribed with a dispatcher is not updated by the thread that changed the model:
+     * the notification is handed to the dispatcher, which calls update() later from its own thread.
+     */
+    class Dispatcher {
+    public:
+
+        /**
+         * @brief Schedules a call to update() of an observer. Can be called from any thread, must not block.
+         * @param observer The observer to update.
+         */
+        virtual void post(Observer& observer) = 0;
+
+        /**
+         * @brief Drops the pending notifications of an observer, which is about to stop observing.
+         * @param observer The observer.
+         */
+        virtual void cancel(const Observer& observer) = 0;
+
+        /**
+         * Virtual destructor for the dispatcher interface.
+         * Ensures proper cleanup of derived classes.
+         */
+        virtual ~Dispatcher() = default;
+    };
+
+} // namespace PiAlarm::common
@@ -3,7 +3,7 @@
 namespace PiAlarm::common {
 
     HasWorker::HasWorker(const std::string& workerName)
-        : HasLogger{workerName}, running_{false}, paused_{false}
+        : HasLogger{workerName}, running_{false}, paused_{false}, stats_{workerName}
     {}
 
     HasWorker::~HasWorker() {
@@ -53,7 +53,11 @@ namespace PiAlarm::common {
             }
             lock.unlock();
 
+            const auto processStart = std::chrono::steady_clock::now();
             workerProcess();
+            const auto processEnd = std::chrono::steady_clock::now();
+
+            stats_.recordProcess(processEnd - processStart, logger());
 
             // Check running_ again in case stopWorker() was called during workerProcess()
             if (!running_) {
@@ -61,14 +65,11 @@ namespace PiAlarm::common {
             }
 
             workerWaitNextCycle();
-        }
-        catch (const std::exception& e) {
-            logger().error("Exception caught during worker process: " + std::string(e.what()));
-            std::this_thread::sleep_for(std::chrono::milliseconds{500});
+            stats_.recordWait(std::chrono::steady_clock::now() - processEnd);
         }
         catch (...) {
-            logger().error("Unknown exception caught during worker process.");
-            std::this_thread::sleep_for(std::chrono::milliseconds{500});
+            stats_.recordException(logger());
+            interruptibleSleepFor(std::chrono::milliseconds{500});
         }
 
         return true;
@@ -87,15 +88,25 @@ namespace PiAlarm::common {
     }
 
     bool HasWorker::interruptibleSleepFor(std::chrono::milliseconds duration) {
+        const auto deadline = std::chrono::steady_clock::now() + duration;
+
         std::unique_lock lock{mutex_};
-        cv_.wait_for(lock, duration, [this]() { return !running_; });
-        return running_; // Return true if still running, false if stopped
+        if (cv_.wait_until(lock, deadline, [this]() { return !running_; })) {
+            return false; // stopped
+        }
+
+        stats_.recordLateness(std::chrono::steady_clock::now() - deadline);
+        return true;
     }
 
     bool HasWorker::interruptibleSleepUntil(std::chrono::system_clock::time_point time_point) {
         std::unique_lock lock{mutex_};
-        cv_.wait_until(lock, time_point, [this]() { return !running_; });
-        return running_; // Return true if still running, false if stopped
+        if (cv_.wait_until(lock, time_point, [this]() { return !running_; })) {
+            return false; // stopped
+        }
+
+        stats_.recordLateness(std::chrono::system_clock::now() - time_point);
+        return true;
     }
 
     void HasWorker::workerWaitNextCycle() {
@@ -7,6 +7,7 @@
 #include <chrono>
 #include <string>
 
+#include "CycleStats.h"
 #include "logging/HasLogger.h"
 
 namespace PiAlarm::common {
@@ -17,6 +18,7 @@ namespace PiAlarm::common {
      *
      * This class provides the core functionality for running, stopping, pausing, and resuming a worker thread.
      * Derived classes must implement the workerProcess() method to define the thread's main logic.
+     * Each cycle is timed in the CycleStats of the worker: a workerProcess() longer than the cycle budget is logged.
      */
     class HasWorker : public logging::HasLogger {
         std::atomic<bool> running_;  ///< Indicates if the worker is currently running
@@ -24,6 +26,7 @@ namespace PiAlarm::common {
         std::thread workerThread_;   ///< Thread for running the worker
         std::mutex mutex_;           ///< Mutex for synchronizing access to the worker state
         std::condition_variable cv_; ///< Condition variable for managing pause/resume
+        CycleStats stats_;           ///< Timing of the cycles of the worker
 
     protected:
         /**
@@ -162,6 +165,19 @@ namespace PiAlarm::common {
         [[nodiscard]]
         bool isWorkerPaused() const;
 
+        /**
+         * @brief Gets the timing of the cycles of the worker.
+         * @return The stats, which can be read while the worker runs.
+         */
+        [[nodiscard]]
+        const CycleStats& getWorkerStats() const { return stats_; }
+
+        /**
+         * @brief Sets the longest workerProcess() that is not logged as an overrun.
+         * @param budget The budget, zero to disable the check.
+         */
+        void setWorkerCycleBudget(std::chrono::milliseconds budget) { stats_.setBudget(budget); }
+
     private:
         /**
          * @brief The main execution loop of the worker.
@@ -184,7 +200,7 @@ namespace PiAlarm::common {
          * @brief Executes a single cycle of the update loop.
          *
          * This method handles passive waiting related to pause or stop states,
-         * calls the workerProcess() method, and applies the delay between cycles.
+         * calls the workerProcess() method, and applies the delay between cycles, timing both.
          * @return true if the worker should continue running, false if it should stop.
          */
         bool executeWorkerCycle();
@@ -0,0 +1,40 @@
+#include "InputLatencyTracer.h"
+
+namespace PiAlarm::common {
+
+    InputLatencyTracer::InputLatencyTracer()
+        : HasLogger{"InputLatency"}
+    {}
+
+    void InputLatencyTracer::logSummary() const {
+        using Milliseconds = std::chrono::duration<double, std::milli>;
+
+        for (size_t i {0}; i < STAGE_COUNT; ++i) {
+            const auto stage = static_cast<Stage>(i);
+            const auto summary = getHistogram(stage).summarize();
+            if (summary.count == 0) continue;
+
+            logger().info(
+                "Edge to {}: {} inputs, mean {:.2f} ms, p50 {:.2f} ms, p95 {:.2f} ms, p99 {:.2f} ms, max {:.2f} ms",
+                getStageName(stage),
+                summary.count,
+                Milliseconds{summary.mean}.count(),
+                Milliseconds{summary.p50}.count(),
+                Milliseconds{summary.p95}.count(),
+                Milliseconds{summary.p99}.count(),
+                Milliseconds{summary.max}.count()
+            );
+        }
+    }
+
+    std::string_view InputLatencyTracer::getStageName(Stage stage) {
+        switch (stage) {
+            case Stage::Dispatched: return "dispatch";
+            case Stage::ViewHandled: return "view";
+            case Stage::Rendered: return "render";
+            case Stage::Displayed: return "display";
+        }
+        return "unknown";
+    }
+
+} // namespace PiAlarm::common
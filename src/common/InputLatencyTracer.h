@@ -0,0 +1,89 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include "LatencyHistogram.h"
+#include "logging/HasLogger.h"
+
+namespace PiAlarm::common {
+
+    /**
+     * @class InputLatencyTracer
+     * @brief Measures how long an input takes to reach the screen.
+     *
+     * Each stage an input event goes through records the time elapsed since the edge of the button,
+     * as detected by the kernel, in the histogram of the stage. Stages may be recorded from any thread.
+     * The histograms can be read at any time, and are logged by logSummary().
+     */
+    class InputLatencyTracer : public logging::HasLogger {
+    public:
+        using TimePoint = std::chrono::steady_clock::time_point; ///< Alias for the time of an edge
+
+        /**
+         * @enum Stage
+         * @brief The points of the input path where the latency is measured.
+         */
+        enum class Stage : uint8_t {
+            Dispatched,  ///< The event enters Application::handleInputEvent
+            ViewHandled, ///< The event enters ViewManager::handleInputEvent
+            Rendered,    ///< The refresh following the event has rendered its frame
+            Displayed    ///< The frame has been flushed to the screen
+        };
+
+        static constexpr size_t STAGE_COUNT {4}; ///< Number of stages
+
+    private:
+        std::array<LatencyHistogram, STAGE_COUNT> histograms_ {}; ///< Latency of each stage
+
+    public:
+
+        /**
+         * @brief Constructs a tracer with empty histograms.
+         */
+        InputLatencyTracer();
+
+        /**
+         * @brief Records that an input reached a stage now.
+         * Lock-free, can be called from any thread.
+         * @param stage The stage reached.
+         * @param edgeTime The time of the button edge that caused the input.
+         */
+        inline void record(Stage stage, TimePoint edgeTime);
+
+        /**
+         * @brief Gets the latency histogram of a stage.
+         * @param stage The stage.
+         * @return The histogram, measured from the button edge.
+         */
+        [[nodiscard]]
+        inline const LatencyHistogram& getHistogram(Stage stage) const;
+
+        /**
+         * @brief Logs the count, mean, p50, p95, p99 and max latency of each stage reached at least once.
+         */
+        void logSummary() const;
+
+        /**
+         * @brief Gets the name of a stage.
+         * @param stage The stage.
+         * @return The name, as logged.
+         */
+        [[nodiscard]]
+        static std::string_view getStageName(Stage stage);
+    };
+
+    // Inline methods implementation
+
+    inline void InputLatencyTracer::record(Stage stage, TimePoint edgeTime) {
+        histograms_[static_cast<size_t>(stage)].record(std::chrono::steady_clock::now() - edgeTime);
+    }
+
+    inline const LatencyHistogram& InputLatencyTracer::getHistogram(Stage stage) const {
+        return histograms_[static_cast<size_t>(stage)];
+    }
+
+} // namespace PiAlarm::common
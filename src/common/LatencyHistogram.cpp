@@ -0,0 +1,75 @@
+#include <algorithm>
+#include <bit>
+
+#include "LatencyHistogram.h"
+
+namespace PiAlarm::common {
+
+    void LatencyHistogram::record(Duration duration) {
+        const uint64_t value = static_cast<uint64_t>(std::max<Duration::rep>(duration.count(), 0));
+
+        buckets_[bucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+        count_.fetch_add(1, std::memory_order_relaxed);
+        total_.fetch_add(value, std::memory_order_relaxed);
+
+        uint64_t max = max_.load(std::memory_order_relaxed);
+        while (value > max && !max_.compare_exchange_weak(max, value, std::memory_order_relaxed)) {}
+    }
+
+    LatencyHistogram::Summary LatencyHistogram::summarize() const {
+        // Snapshot of the buckets, the percentiles are computed from it
+        std::array<uint64_t, BUCKET_COUNT> counts {};
+        uint64_t count {0};
+        for (size_t i {0}; i < BUCKET_COUNT; ++i) {
+            counts[i] = buckets_[i].load(std::memory_order_relaxed);
+            count += counts[i];
+        }
+
+        Summary summary;
+        if (count == 0) return summary;
+
+        const uint64_t max = max_.load(std::memory_order_relaxed);
+        const uint64_t recorded = std::max<uint64_t>(count_.load(std::memory_order_relaxed), 1);
+
+        summary.count = count;
+        summary.mean = Duration{total_.load(std::memory_order_relaxed) / recorded};
+        summary.max = Duration{max};
+
+        auto percentile = [&](uint64_t perMille) {
+            const uint64_t rank = std::max<uint64_t>((count * perMille + 999) / 1000, 1); // rounded up
+            uint64_t cumulated {0};
+
+            for (size_t i {0}; i < BUCKET_COUNT; ++i) {
+                cumulated += counts[i];
+                if (cumulated >= rank) return Duration{std::min(bucketValue(i), max)};
+            }
+            return Duration{max};
+        };
+
+        summary.p50 = percentile(500);
+        summary.p95 = percentile(950);
+        summary.p99 = percentile(990);
+        return summary;
+    }
+
+    size_t LatencyHistogram::bucketIndex(uint64_t value) {
+        if (value < SUB_BUCKETS) return value; // exact
+
+        const unsigned exponent = static_cast<unsigned>(std::bit_width(value)) - 1;
+        if (exponent > MAX_EXPONENT) return BUCKET_COUNT - 1; // too long, counted with the longest ones
+
+        const uint64_t subBucket = (value >> (exponent - SUB_BUCKET_BITS)) & (SUB_BUCKETS - 1);
+        return (exponent - SUB_BUCKET_BITS + 1) * SUB_BUCKETS + subBucket;
+    }
+
+    uint64_t LatencyHistogram::bucketValue(size_t index) {
+        if (index < SUB_BUCKETS) return index;
+
+        const unsigned exponent = static_cast<unsigned>(index / SUB_BUCKETS) + SUB_BUCKET_BITS - 1;
+        const uint64_t subBucket = index % SUB_BUCKETS;
+        const uint64_t width = uint64_t{1} << (exponent - SUB_BUCKET_BITS);
+
+        return (SUB_BUCKETS + subBucket) * width + width / 2;
+    }
+
+} // namespace PiAlarm::common
@@ -0,0 +1,95 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace PiAlarm::common {
+
+    /**
+     * @class LatencyHistogram
+     * @brief Distribution of durations, recorded and read from any thread without locking.
+     *
+     * Durations are counted in buckets of logarithmic size: each power of two of nanoseconds is split
+     * into SUB_BUCKETS buckets, so a percentile is known within 1/SUB_BUCKETS of its value.
+     * Recording is a few relaxed atomic operations, it does not allocate.
+     * A summary taken while durations are recorded may miss the last ones, it is still consistent enough for statistics.
+     */
+    class LatencyHistogram {
+    public:
+        using Duration = std::chrono::nanoseconds; ///< Resolution of the histogram
+
+        /**
+         * @struct Summary
+         * @brief Statistics of the recorded durations.
+         */
+        struct Summary {
+            uint64_t count {0}; ///< Number of recorded durations
+            Duration mean {}; ///< Average duration
+            Duration p50 {}; ///< Median duration
+            Duration p95 {}; ///< 95th percentile
+            Duration p99 {}; ///< 99th percentile
+            Duration max {}; ///< Longest duration
+        };
+
+    private:
+        static constexpr unsigned SUB_BUCKET_BITS {3}; ///< log2 of the number of buckets per power of two
+        static constexpr uint64_t SUB_BUCKETS {1u << SUB_BUCKET_BITS}; ///< Number of buckets per power of two
+        static constexpr unsigned MAX_EXPONENT {36}; ///< Longer durations than 2^(MAX_EXPONENT+1) ns (about 2 min) go to the last bucket
+        static constexpr size_t BUCKET_COUNT {(MAX_EXPONENT - SUB_BUCKET_BITS + 2) * SUB_BUCKETS}; ///< Number of buckets
+
+        std::array<std::atomic<uint64_t>, BUCKET_COUNT> buckets_ {}; ///< Number of durations in each bucket
+        std::atomic<uint64_t> count_ {0}; ///< Number of recorded durations
+        std::atomic<uint64_t> total_ {0}; ///< Sum of the recorded durations in nanoseconds
+        std::atomic<uint64_t> max_ {0}; ///< Longest recorded duration in nanoseconds
+
+    public:
+
+        /**
+         * @brief Records a duration.
+         * @param duration The duration, a negative one is counted as zero.
+         */
+        void record(Duration duration);
+
+        /**
+         * @brief Computes the statistics of the durations recorded so far.
+         * @return The summary, with a count of 0 if nothing was recorded.
+         */
+        [[nodiscard]]
+        Summary summarize() const;
+
+        /**
+         * @brief Gets the number of recorded durations.
+         * @return The number of durations.
+         */
+        [[nodiscard]]
+        inline uint64_t getCount() const;
+
+    private:
+
+        /**
+         * @brief Gets the bucket counting a duration.
+         * @param value The duration in nanoseconds.
+         * @return The index of the bucket.
+         */
+        [[nodiscard]]
+        static size_t bucketIndex(uint64_t value);
+
+        /**
+         * @brief Gets the duration representing a bucket.
+         * @param index The index of the bucket.
+         * @return The middle of the bucket in nanoseconds.
+         */
+        [[nodiscard]]
+        static uint64_t bucketValue(size_t index);
+    };
+
+    // Inline methods implementation
+
+    inline uint64_t LatencyHistogram::getCount() const {
+        return count_.load(std::memory_order_relaxed);
+    }
+
+} // namespace PiAlarm::common
@@ -0,0 +1,82 @@
+#include <algorithm>
+
+#include "NotificationQueue.h"
+
+namespace PiAlarm::common {
+
+    NotificationQueue::NotificationQueue(Observer& wakeUp)
+        : wakeUp_{wakeUp}
+    {}
+
+    void NotificationQueue::post(Observer& observer) {
+        posted_.fetch_add(1, std::memory_order_relaxed);
+
+        bool wasEmpty;
+        {
+            std::lock_guard lock{mutex_};
+            if (std::ranges::find(pending_, &observer) != pending_.end()) {
+                coalesced_.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+
+            wasEmpty = pending_.empty();
+            pending_.push_back(&observer);
+        }
+
+        if (wasEmpty) wakeUp_.update();
+    }
+
+    void NotificationQueue::cancel(const Observer& observer) {
+        std::unique_lock lock{mutex_};
+        std::erase(pending_, &observer);
+        std::ranges::replace(running_, &observer, nullptr);
+
+        // The observer may be cancelled from its own update, only the other threads wait for it
+        if (drainingThread_ != std::this_thread::get_id()) {
+            updated_.wait(lock, [&] { return updating_ != &observer; });
+        }
+    }
+
+    size_t NotificationQueue::drain() {
+        {
+            std::lock_guard lock{mutex_};
+            running_.swap(pending_);
+            drainingThread_ = std::this_thread::get_id();
+        }
+
+        // Whatever happens to the updates, cancel() must not wait for them once drain() returns
+        struct DrainGuard {
+            NotificationQueue& queue;
+            ~DrainGuard() {
+                {
+                    std::lock_guard lock{queue.mutex_};
+                    queue.running_.clear();
+                    queue.updating_ = nullptr;
+                    queue.drainingThread_ = {};
+                }
+                queue.updated_.notify_all();
+            }
+        } drainGuard{*this};
+
+        size_t count {0};
+        for (size_t i {0};; ++i) {
+            Observer* observer;
+            {
+                std::lock_guard lock{mutex_};
+
+                // Skip the observers cancelled since the queue was taken, even by an earlier update of this drain
+                while (i < running_.size() && !running_[i]) ++i;
+                if (i == running_.size()) break;
+
+                observer = updating_ = running_[i];
+            }
+            updated_.notify_all(); // the previous observer is not being updated anymore
+
+            observer->update();
+            ++count;
+        }
+
+        return count;
+    }
+
+} // namespace PiAlarm::common
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "Dispatcher.h"
+
+namespace PiAlarm::common {
+
+    /**
+     * @class NotificationQueue
+     * @brief Dispatcher running the notifications on the thread that drains it, typically the UI thread.
+     *
+     * Any thread may post. An observer waits in the queue at most once: it is updated once per drain,
+     * however many times its models changed meanwhile. When the queue goes from empty to non-empty,
+     * the wake-up observer (e.g. the event loop of the draining thread) is updated, from the posting thread.
+     */
+    class NotificationQueue final : public Dispatcher {
+        Observer& wakeUp_; ///< Observer updated when the queue stops being empty
+
+        std::mutex mutex_; ///< Mutex guarding pending_, running_, updating_ and drainingThread_
+        std::condition_variable updated_; ///< Signaled each time an update of drain() ends
+        std::vector<Observer*> pending_; ///< Observers to update, each one at most once
+        std::vector<Observer*> running_; ///< Observers taken by the running drain(), null once cancelled
+        Observer* updating_ {nullptr}; ///< Observer drain() is updating, if any
+        std::thread::id drainingThread_; ///< Thread running drain(), if any
+
+        std::atomic<uint64_t> posted_ {0}; ///< Number of posted notifications
+        std::atomic<uint64_t> coalesced_ {0}; ///< Number of notifications merged with a pending one
+
+    public:
+
+        /**
+         * @brief Constructs an empty queue.
+         * @param wakeUp Observer updated when a notification is queued while the queue is empty, it must outlive the queue.
+         */
+        explicit NotificationQueue(Observer& wakeUp);
+
+        NotificationQueue(const NotificationQueue&) = delete; ///< No copy constructor
+        NotificationQueue& operator=(const NotificationQueue&) = delete; ///< No copy assignment operator
+
+        /**
+         * @brief Queues an update of the observer, unless it is already pending.
+         * @param observer The observer to update.
+         */
+        void post(Observer& observer) override;
+
+        /**
+         * @brief Removes the pending update of an observer, including one taken by a running drain().
+         * If drain() is updating the observer on another thread, waits until the update ends.
+         * Once it returns, the observer is not updated anymore.
+         * @param observer The observer.
+         */
+        void cancel(const Observer& observer) override;
+
+        /**
+         * @brief Updates the observers queued so far. Must be called from a single thread.
+         * Notifications posted while draining are left for the next drain.
+         * @return The number of updated observers.
+         */
+        size_t drain();
+
+        /**
+         * @brief Gets the number of notifications posted since the creation of the queue.
+         * @return The number of notifications.
+         */
+        [[nodiscard]]
+        uint64_t getPostedCount() const { return posted_.load(std::memory_order_relaxed); }
+
+        /**
+         * @brief Gets the number of notifications merged into an update already pending.
+         * @return The number of coalesced notifications.
+         */
+        [[nodiscard]]
+        uint64_t getCoalescedCount() const { return coalesced_.load(std::memory_order_relaxed); }
+    };
+
+} // namespace PiAlarm::common
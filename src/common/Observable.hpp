@@ -1,6 +1,12 @@
 #pragma once
 
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
 #include <vector>
+
+#include "Dispatcher.h"
 #include "Observer.h"
 
 namespace PiAlarm::common {
@@ -10,44 +16,174 @@ namespace PiAlarm::common {
      * @brief The observable part of the Observer design pattern.
      *
      * This class maintains a list of observers and provides methods to add,
-     * remove, and notify them of changes.
+     * remove, and notify them of changes, from any thread.
+     *
+     * The list is copy-on-write: adding or removing an observer publishes a new list,
+     * and notifyObservers() walks the list published when it started, without any lock.
+     * Each subscription counts the notifications reaching its observer, so a removal waits
+     * for exactly those, whatever list they walk.
+     * An observer subscribed with a Dispatcher is updated later by the thread of the dispatcher,
+     * so the thread changing the model never runs its logic.
+     *
+     * Each notification increments a generation number. A consumer only interested in the latest state
+     * can compare it with the generation it last saw, instead of handling every notification.
      */
     class Observable {
-        // 'observers' is mutable to allow adding/removing observers from const methods without altering the observable state.
-        mutable std::vector<Observer*> observers; ///< The list of observers
+    public:
+
+        /**
+         * @struct Subscription
+         * @brief An observer, the dispatcher delivering its notifications, and the notifications reaching it.
+         */
+        struct Subscription {
+            Observer* observer; ///< The observer
+            Dispatcher* dispatcher; ///< Dispatcher updating the observer, null to update it on the notifying thread
+            std::atomic<unsigned> calls {0}; ///< Number of notifications updating or posting the observer right now
+            std::atomic<bool> removed {false}; ///< Set once the observer is removed, no notification may reach it anymore
+        };
+
+    private:
+        using SubscriptionList = std::vector<std::shared_ptr<Subscription>>; ///< Alias for the published list type
+
+        /**
+         * @struct NotifyingFrame
+         * @brief A notification running on this thread, linked to the ones it runs within.
+         */
+        struct NotifyingFrame {
+            const Subscription* calling {nullptr}; ///< Subscription whose observer is being reached
+            const NotifyingFrame* outer; ///< Notification running when this one started, null if none
+        };
+
+        // Mutable to allow adding/removing observers from const methods without altering the observable state.
+        mutable std::mutex writeMutex_; ///< Serializes the changes of the list
+        mutable std::atomic<std::shared_ptr<const SubscriptionList>> subscriptions_ {std::make_shared<const SubscriptionList>()}; ///< The published list
+        std::atomic<uint64_t> generation_ {0}; ///< Number of notified changes
+
+        inline static thread_local const NotifyingFrame* notifying_ {nullptr}; ///< Innermost notification running on this thread
 
     public:
 
+        Observable() = default;
+
         /**
          * Virtual destructor for the observable.
          * Ensures proper cleanup of derived classes.
          */
         virtual ~Observable() = default;
 
+        Observable(const Observable&) = delete; ///< No copy constructor
+        Observable& operator=(const Observable&) = delete; ///< No copy assignment operator
+
         /**
          * Adds an observer to the list of observers.
          * @param observer The observer to add.
+         * @param dispatcher The dispatcher updating the observer, it must outlive the subscription.
+         * Null to update the observer on the thread that notifies.
          */
-        void addObserver(Observer* observer) const {
-            observers.push_back(observer);
+        void addObserver(Observer* observer, Dispatcher* dispatcher = nullptr) const {
+            auto subscription = std::make_shared<Subscription>();
+            subscription->observer = observer;
+            subscription->dispatcher = dispatcher;
+
+            std::lock_guard lock{writeMutex_};
+
+            auto list = std::make_shared<SubscriptionList>(*subscriptions_.load());
+            list->push_back(std::move(subscription));
+            subscriptions_.store(std::move(list));
         }
 
         /**
          * Removes an observer from the list of observers.
+         * Once it returns, no notification, even one started on another thread with an older list, can still reach the observer,
+         * and its pending dispatched notifications are dropped.
+         * Called by the observer from its own update(), it waits for the other threads only.
          * @param observer The observer to remove.
          */
         void removeObserver(Observer* observer) const {
-            std::erase(observers, observer);
+            SubscriptionList removed;
+            {
+                std::lock_guard lock{writeMutex_};
+
+                auto list = std::make_shared<SubscriptionList>(*subscriptions_.load());
+                std::erase_if(*list, [&](const std::shared_ptr<Subscription>& subscription) {
+                    if (subscription->observer != observer) return false;
+
+                    removed.push_back(subscription);
+                    return true;
+                });
+                subscriptions_.store(std::move(list));
+            }
+
+            for (const auto& subscription : removed) {
+                // From now on, the notifications skip the observer, whatever list they walk
+                subscription->removed.store(true);
+
+                // Wait for the ones already reaching it, except those running on this thread below this call
+                unsigned ownCalls {0};
+                for (const NotifyingFrame* frame {notifying_}; frame; frame = frame->outer) {
+                    if (frame->calling == subscription.get()) ++ownCalls;
+                }
+
+                for (unsigned calls {subscription->calls.load()}; calls > ownCalls; calls = subscription->calls.load()) {
+                    subscription->calls.wait(calls);
+                }
+
+                // Only then, no notification can be posted anymore
+                if (subscription->dispatcher) subscription->dispatcher->cancel(*observer);
+            }
+        }
+
+        /**
+         * Gets the generation of the observable.
+         * It increases each time a change is notified, and never decreases.
+         * Once a new generation is seen, the change that produced it can be read.
+         * @return The number of changes notified since the creation of the observable.
+         */
+        [[nodiscard]]
+        uint64_t getGeneration() const {
+            return generation_.load(std::memory_order_acquire);
         }
 
         /**
          * Notifies all observers of a change.
+         * The generation is incremented before any observer is reached.
          */
         virtual void notifyObservers() {
-            for (Observer* observer : observers) {
-                observer->update();
+            generation_.fetch_add(1, std::memory_order_release);
+
+            const auto list = subscriptions_.load();
+
+            NotifyingFrame frame {nullptr, notifying_};
+            struct FrameGuard {
+                NotifyingFrame& frame;
+                explicit FrameGuard(NotifyingFrame& frame) : frame{frame} { notifying_ = &frame; }
+                ~FrameGuard() { notifying_ = frame.outer; }
+            } frameGuard{frame}; // an observer may throw
+
+            for (const auto& subscription : *list) {
+                // Announce the call before checking the flag, removeObserver() does the opposite
+                subscription->calls.fetch_add(1);
+
+                struct CallGuard {
+                    NotifyingFrame& frame;
+                    Subscription& subscription;
+                    ~CallGuard() {
+                        frame.calling = nullptr;
+                        subscription.calls.fetch_sub(1);
+                        if (subscription.removed.load()) subscription.calls.notify_all(); // a removal waits for this call
+                    }
+                } callGuard{frame, *subscription};
+
+                if (subscription->removed.load()) continue;
+
+                frame.calling = subscription.get();
+                if (subscription->dispatcher) {
+                    subscription->dispatcher->post(*subscription->observer);
+                } else {
+                    subscription->observer->update();
+                }
             }
         }
     };
 
-} // namespace PiAlarm::common
\ No newline at end of file
+} // namespace PiAlarm::common
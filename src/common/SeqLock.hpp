@@ -0,0 +1,106 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace PiAlarm::common {
+
+    /**
+     * @class SeqLock
+     * @brief Sequence lock: a value written by one thread and read by any thread without locking.
+     *
+     * The writer makes the sequence number odd, copies the value, then makes it even again.
+     * A reader copies the value between two reads of the sequence number, and copies it again
+     * if a write was in progress or happened meanwhile. Readers never block nor slow the writer down,
+     * they only retry while a write overlaps their copy, which is as short as copying the value.
+     *
+     * The value is kept in atomic words, so a torn copy is detected and discarded, never undefined.
+     * It is only suited to small trivially copyable values. Writes must be serialized by the caller.
+     *
+     * @tparam T Type of the value, trivially copyable.
+     */
+    template<typename T>
+    class SeqLock {
+        static_assert(std::is_trivially_copyable_v<T>, "SeqLock copies the value word by word");
+
+        using Word = uint32_t; ///< Unit of the copies, lock-free on every target
+        static_assert(std::atomic<Word>::is_always_lock_free);
+
+        static constexpr size_t WORDS {(sizeof(T) + sizeof(Word) - 1) / sizeof(Word)}; ///< Number of words holding the value
+
+        std::atomic<uint32_t> sequence_ {0}; ///< Odd while a write is in progress
+        std::array<std::atomic<Word>, WORDS> words_ {}; ///< The value, word by word
+
+    public:
+
+        /**
+         * @brief Constructs a sequence lock holding a value.
+         * @param value The initial value.
+         */
+        explicit SeqLock(const T& value = T{}) {
+            store(value);
+        }
+
+        SeqLock(const SeqLock&) = delete; ///< No copy constructor
+        SeqLock& operator=(const SeqLock&) = delete; ///< No copy assignment operator
+
+        /**
+         * @brief Publishes a new value.
+         * Must not be called by two threads at the same time.
+         * @param value The value to publish.
+         */
+        void store(const T& value);
+
+        /**
+         * @brief Gets a consistent copy of the last published value.
+         * Can be called by any thread, at any time.
+         * @return The value published by the last completed store().
+         */
+        [[nodiscard]]
+        T load() const;
+    };
+
+    // Template methods implementation
+
+    template<typename T>
+    void SeqLock<T>::store(const T& value) {
+        std::array<Word, WORDS> buffer {};
+        std::memcpy(buffer.data(), &value, sizeof(T));
+
+        const uint32_t sequence = sequence_.load(std::memory_order_relaxed);
+        sequence_.store(sequence + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release); // the odd sequence is visible before any word
+
+        for (size_t i {0}; i < WORDS; ++i) {
+            words_[i].store(buffer[i], std::memory_order_relaxed);
+        }
+
+        sequence_.store(sequence + 2, std::memory_order_release);
+    }
+
+    template<typename T>
+    T SeqLock<T>::load() const {
+        std::array<Word, WORDS> buffer;
+
+        while (true) {
+            const uint32_t before = sequence_.load(std::memory_order_acquire);
+
+            if ((before & 1) == 0) {
+                for (size_t i {0}; i < WORDS; ++i) {
+                    buffer[i] = words_[i].load(std::memory_order_relaxed);
+                }
+                std::atomic_thread_fence(std::memory_order_acquire); // the words are read before the sequence again
+
+                if (sequence_.load(std::memory_order_relaxed) == before) break;
+            }
+        }
+
+        T value;
+        std::memcpy(static_cast<void*>(&value), buffer.data(), sizeof(T)); // trivially copyable, even with default member values
+        return value;
+    }
+
+} // namespace PiAlarm::common
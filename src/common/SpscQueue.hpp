@@ -0,0 +1,134 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <utility>
+
+namespace PiAlarm::common {
+
+    /**
+     * @class SpscQueue
+     * @brief Bounded queue between one producer thread and one consumer thread, without any lock.
+     *
+     * The items live in a ring of Capacity slots. Each side only writes its own index, and reads the other one
+     * with acquire ordering: pushing and popping never wait nor allocate.
+     * When the ring is full, the pushed item is not queued and counted as dropped, so the producer is never held
+     * up by a slow consumer and the loss can be reported.
+     *
+     * @tparam T Type of the items, copied into the ring.
+     * @tparam Capacity Number of slots, a power of two.
+     */
+    template<typename T, size_t Capacity>
+    class SpscQueue {
+        static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+        static constexpr size_t CACHE_LINE_SIZE {64}; ///< Indexes are kept apart so the two threads do not share a cache line
+        static constexpr size_t INDEX_MASK {Capacity - 1}; ///< Mask turning an index into a slot
+
+        std::array<T, Capacity> slots_ {}; ///< The ring of items
+        alignas(CACHE_LINE_SIZE) std::atomic<size_t> head_ {0}; ///< Index of the next item to pop, written by the consumer
+        alignas(CACHE_LINE_SIZE) std::atomic<size_t> tail_ {0}; ///< Index of the next item to push, written by the producer
+        std::atomic<uint64_t> pushed_ {0}; ///< Number of items queued, written by the producer
+        std::atomic<uint64_t> dropped_ {0}; ///< Number of items dropped because the ring was full, written by the producer
+        std::atomic<size_t> highWatermark_ {0}; ///< Largest number of items seen in the ring, written by the producer
+
+    public:
+
+        /**
+         * @brief Queues an item. Must only be called by the producer thread.
+         * @param item The item to queue.
+         * @return True if the item was queued, false if the ring was full and the item was dropped.
+         */
+        bool tryPush(const T& item);
+
+        /**
+         * @brief Takes the oldest item. Must only be called by the consumer thread.
+         * @return The item, empty if the queue is empty.
+         */
+        std::optional<T> tryPop();
+
+        /**
+         * @brief Takes every queued item and passes them, oldest first, to a function.
+         * Must only be called by the consumer thread.
+         * @param consume The function called with each item.
+         * @return The number of items taken.
+         */
+        template<typename Consumer>
+        size_t drain(Consumer&& consume);
+
+        /**
+         * @brief Gets the number of items queued since the creation of the queue.
+         * @return The number of queued items.
+         */
+        [[nodiscard]]
+        uint64_t getPushedCount() const { return pushed_.load(std::memory_order_relaxed); }
+
+        /**
+         * @brief Gets the number of items dropped because the queue was full.
+         * @return The number of dropped items.
+         */
+        [[nodiscard]]
+        uint64_t getDroppedCount() const { return dropped_.load(std::memory_order_relaxed); }
+
+        /**
+         * @brief Gets the largest number of items the queue held at once.
+         * @return The high watermark, at most Capacity.
+         */
+        [[nodiscard]]
+        size_t getHighWatermark() const { return highWatermark_.load(std::memory_order_relaxed); }
+
+        /**
+         * @brief Gets the number of slots of the queue.
+         * @return Capacity.
+         */
+        [[nodiscard]]
+        static constexpr size_t capacity() { return Capacity; }
+    };
+
+    // Template methods implementation
+
+    template<typename T, size_t Capacity>
+    bool SpscQueue<T, Capacity>::tryPush(const T& item) {
+        const size_t tail = tail_.load(std::memory_order_relaxed);
+        const size_t size = tail - head_.load(std::memory_order_acquire); // indexes only grow, the difference is the size
+
+        if (size >= Capacity) {
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        slots_[tail & INDEX_MASK] = item;
+        tail_.store(tail + 1, std::memory_order_release); // publishes the slot to the consumer
+
+        pushed_.fetch_add(1, std::memory_order_relaxed);
+        if (size + 1 > highWatermark_.load(std::memory_order_relaxed)) {
+            highWatermark_.store(size + 1, std::memory_order_relaxed);
+        }
+        return true;
+    }
+
+    template<typename T, size_t Capacity>
+    std::optional<T> SpscQueue<T, Capacity>::tryPop() {
+        const size_t head = head_.load(std::memory_order_relaxed);
+        if (head == tail_.load(std::memory_order_acquire)) return std::nullopt;
+
+        std::optional<T> item {std::move(slots_[head & INDEX_MASK])};
+        head_.store(head + 1, std::memory_order_release); // gives the slot back to the producer
+        return item;
+    }
+
+    template<typename T, size_t Capacity>
+    template<typename Consumer>
+    size_t SpscQueue<T, Capacity>::drain(Consumer&& consume) {
+        size_t count {0};
+        while (auto item = tryPop()) {
+            consume(*item);
+            ++count;
+        }
+        return count;
+    }
+
+} // namespace PiAlarm::common
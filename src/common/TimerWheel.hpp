@@ -0,0 +1,252 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace PiAlarm::common {
+
+    /**
+     * @class TimerWheel
+     * @brief Hierarchical timing wheel: timers sorted by expiry tick, scheduled and expired in constant time.
+     *
+     * Time is counted in ticks. The wheel has LEVELS levels of SLOTS slots: a slot of level 0 spans one tick,
+     * a slot of level L spans SLOTS^L ticks. A timer goes to the lowest level whose current window contains its expiry,
+     * and moves down one level each time the wheel reaches the slot it sits in, until it expires from level 0.
+     * Timers beyond the range of the wheel wait in an overflow list, placed again each time the top level wraps.
+     *
+     * The wheel never moves tick by tick: advance() jumps from one non-empty slot to the next,
+     * so sleeping for hours costs as much as sleeping for one tick.
+     * It is not thread safe.
+     *
+     * @tparam T Type of the value carried by a timer.
+     */
+    template<typename T>
+    class TimerWheel {
+    public:
+        using Tick = uint64_t; ///< Alias for a time in ticks
+
+        static constexpr unsigned SLOT_BITS {6}; ///< log2 of the number of slots per level
+        static constexpr size_t SLOTS {size_t{1} << SLOT_BITS}; ///< Number of slots per level
+        static constexpr unsigned LEVELS {4}; ///< Number of levels, the wheel spans SLOTS^LEVELS ticks
+
+    private:
+        static constexpr Tick SLOT_MASK {SLOTS - 1}; ///< Mask of the slot index within a level
+        static constexpr unsigned WHEEL_BITS {SLOT_BITS * LEVELS}; ///< Number of tick bits spanned by the wheel
+
+        /**
+         * @struct Timer
+         * @brief A scheduled value and its expiry tick.
+         */
+        struct Timer {
+            Tick expiry; ///< Tick the timer expires at
+            T value; ///< Value given back on expiry
+        };
+
+        using Slot = std::vector<Timer>; ///< Alias for the timers of a slot
+
+        std::array<std::array<Slot, SLOTS>, LEVELS> levels_ {}; ///< The slots of each level
+        Slot overflow_ {}; ///< Timers beyond the span of the wheel
+        Slot due_ {}; ///< Timers expired but not returned yet
+        Tick current_; ///< Current tick of the wheel
+        size_t size_ {0}; ///< Number of scheduled timers
+
+    public:
+
+        /**
+         * @brief Constructs an empty wheel.
+         * @param start The current tick.
+         */
+        explicit TimerWheel(Tick start = 0) : current_{start} {}
+
+        /**
+         * @brief Schedules a timer.
+         * @param expiry Tick the timer expires at. A tick already reached expires on the next advance().
+         * @param value Value given back on expiry.
+         */
+        void schedule(Tick expiry, T value);
+
+        /**
+         * @brief Moves the wheel to a tick and collects the timers expired until then, in expiry order.
+         * @param now The tick to move to, nothing happens if it was already reached.
+         * @param expired Vector the values of the expired timers are appended to.
+         */
+        void advance(Tick now, std::vector<T>& expired);
+
+        /**
+         * @brief Gets the next tick advance() has something to do at.
+         * It is the expiry of the next timer, or an earlier tick where timers move down a level.
+         * @return The tick, the current one if timers are due, empty if the wheel is empty.
+         */
+        [[nodiscard]]
+        std::optional<Tick> getNextTick() const;
+
+        /**
+         * @brief Removes the timers whose value matches a predicate.
+         * @param predicate Function called with each value, returning true to remove its timer.
+         * @return The number of removed timers.
+         */
+        template<typename Predicate>
+        size_t cancelIf(Predicate predicate);
+
+        /**
+         * @brief Gets the current tick of the wheel.
+         * @return The last tick advanced to.
+         */
+        [[nodiscard]]
+        Tick getCurrentTick() const { return current_; }
+
+        /**
+         * @brief Gets the number of scheduled timers.
+         * @return The number of timers, expired ones included until returned by advance().
+         */
+        [[nodiscard]]
+        size_t size() const { return size_; }
+
+        /**
+         * @brief Checks if no timer is scheduled.
+         * @return True if the wheel is empty.
+         */
+        [[nodiscard]]
+        bool empty() const { return size_ == 0; }
+
+    private:
+
+        /**
+         * @brief Places a timer in the slot matching its expiry, relatively to the current tick.
+         * @param timer The timer to place.
+         */
+        void place(Timer&& timer);
+
+        /**
+         * @brief Moves the timers of a slot to the slots matching their expiry.
+         * @param slot The slot to empty.
+         */
+        void replace(Slot& slot);
+
+        /**
+         * @brief Performs what is due at the current tick: overflow, cascades of the upper levels and expiry of level 0.
+         */
+        void processCurrentTick();
+    };
+
+    // Template methods implementation
+
+    template<typename T>
+    void TimerWheel<T>::schedule(Tick expiry, T value) {
+        place({expiry, std::move(value)});
+        ++size_;
+    }
+
+    template<typename T>
+    void TimerWheel<T>::advance(Tick now, std::vector<T>& expired) {
+        while (true) {
+            const auto next = getNextTick();
+            if (!next || *next > now) break;
+
+            if (*next != current_) {
+                current_ = *next;
+                processCurrentTick();
+            }
+
+            for (Timer& timer : due_) {
+                expired.push_back(std::move(timer.value));
+            }
+            size_ -= due_.size();
+            due_.clear();
+        }
+
+        // No slot lies between the last processed tick and now, the wheel can jump there
+        if (now > current_) current_ = now;
+    }
+
+    template<typename T>
+    std::optional<typename TimerWheel<T>::Tick> TimerWheel<T>::getNextTick() const {
+        if (!due_.empty()) return current_;
+
+        // A non-empty slot of a level is reached before any slot of the levels above
+        for (unsigned level {0}; level < LEVELS; ++level) {
+            const unsigned shift {SLOT_BITS * level};
+            const Tick windowStart = (current_ >> (shift + SLOT_BITS)) << (shift + SLOT_BITS);
+
+            for (Tick index {((current_ >> shift) & SLOT_MASK) + 1}; index < SLOTS; ++index) {
+                if (!levels_[level][index].empty()) return windowStart | (index << shift);
+            }
+        }
+
+        if (!overflow_.empty()) return ((current_ >> WHEEL_BITS) + 1) << WHEEL_BITS;
+        return std::nullopt;
+    }
+
+    template<typename T>
+    template<typename Predicate>
+    size_t TimerWheel<T>::cancelIf(Predicate predicate) {
+        size_t removed {0};
+        auto cancelIn = [&](Slot& slot) {
+            removed += std::erase_if(slot, [&](const Timer& timer) { return predicate(timer.value); });
+        };
+
+        for (auto& level : levels_) {
+            for (Slot& slot : level) cancelIn(slot);
+        }
+        cancelIn(overflow_);
+        cancelIn(due_);
+
+        size_ -= removed;
+        return removed;
+    }
+
+    template<typename T>
+    void TimerWheel<T>::place(Timer&& timer) {
+        if (timer.expiry <= current_) {
+            due_.push_back(std::move(timer));
+            return;
+        }
+
+        // Lowest level whose current window contains the expiry
+        for (unsigned level {0}; level < LEVELS; ++level) {
+            const unsigned shift {SLOT_BITS * level};
+            if ((timer.expiry >> (shift + SLOT_BITS)) == (current_ >> (shift + SLOT_BITS))) {
+                levels_[level][(timer.expiry >> shift) & SLOT_MASK].push_back(std::move(timer));
+                return;
+            }
+        }
+
+        overflow_.push_back(std::move(timer));
+    }
+
+    template<typename T>
+    void TimerWheel<T>::replace(Slot& slot) {
+        Slot timers {std::move(slot)};
+        slot.clear();
+
+        for (Timer& timer : timers) {
+            place(std::move(timer));
+        }
+    }
+
+    template<typename T>
+    void TimerWheel<T>::processCurrentTick() {
+        if ((current_ & ((Tick{1} << WHEEL_BITS) - 1)) == 0) {
+            replace(overflow_);
+        }
+
+        // From the top: a cascading slot can fill the slot of the level below starting at the same tick
+        for (unsigned level {LEVELS - 1}; level > 0; --level) {
+            const unsigned shift {SLOT_BITS * level};
+            if ((current_ & ((Tick{1} << shift) - 1)) == 0) {
+                replace(levels_[level][(current_ >> shift) & SLOT_MASK]);
+            }
+        }
+
+        Slot& slot = levels_[0][current_ & SLOT_MASK];
+        for (Timer& timer : slot) {
+            due_.push_back(std::move(timer));
+        }
+        slot.clear();
+    }
+
+} // namespace PiAlarm::common
@@ -0,0 +1,150 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+
+/**
+ * @namespace PiAlarm::display
+ * @brief Namespace for the display outputs of the PiAlarm application.
+ */
+namespace PiAlarm::display {
+
+    /**
+     * @class HeadlessScreen
+     * @brief Stands in for the SSD1322 display when there is no screen, e.g. to benchmark on any Linux box.
+     *
+     * The flushed regions are copied into an in-memory copy of the display RAM, and timed the same way
+     * as hardware::SSD1322 does. The time the bytes would take on the SPI line can be simulated, so the flushes
+     * keep the duration they have on the real screen.
+     */
+    class HeadlessScreen {
+    public:
+        static constexpr size_t DISPLAY_WIDTH {256}; ///< Width of the display in pixels
+        static constexpr size_t DISPLAY_HEIGHT {64}; ///< Height of the display in pixels
+        static constexpr size_t ROW_BYTES {DISPLAY_WIDTH / 2}; ///< Bytes per row (4 bits per pixel)
+        static constexpr size_t PIXELS_PER_COLUMN {4}; ///< Pixels per SSD1322 column, the horizontal granularity of a flush
+
+        /**
+         * @struct FlushTiming
+         * @brief Measured durations of the flushes, same fields as hardware::SSD1322::FlushTiming.
+         */
+        struct FlushTiming {
+            size_t flushes {0}; ///< Number of flushes
+            size_t bytes {0}; ///< Pixel bytes copied by the flushes
+            size_t messages {0}; ///< Always 0, there is no SPI transfer
+            std::chrono::nanoseconds last {0}; ///< Duration of the last flush
+            std::chrono::nanoseconds max {0}; ///< Duration of the longest flush
+            std::chrono::nanoseconds total {0}; ///< Sum of the flush durations
+            std::chrono::nanoseconds lineTime {0}; ///< Time the bytes would take on the line at the simulated SPI rate
+        };
+
+    private:
+        std::array<uint8_t, DISPLAY_HEIGHT * ROW_BYTES> ram_ {}; ///< Copy of the display RAM, packed 2 pixels per byte
+        uint32_t simulatedSpeedHz_; ///< SPI clock rate whose line time is waited for by each flush, 0 to not wait
+        FlushTiming flushTiming_ {}; ///< Durations of the flushes
+
+    public:
+
+        /**
+         * @brief Constructs a headless screen.
+         * @param simulatedSpeedHz SPI clock rate to simulate, each flush waits for the time its bytes would
+         *                         take on the line. 0 (default) to not wait.
+         */
+        explicit HeadlessScreen(uint32_t simulatedSpeedHz = 0) : simulatedSpeedHz_{simulatedSpeedHz} {}
+
+        /**
+         * @brief Does nothing, there is no controller to initialize.
+         */
+        void initialize() {}
+
+        /**
+         * @brief Copies a full framebuffer into the display RAM.
+         * @param buffer Pointer to the framebuffer (4 bits per pixel, packed: 2 pixels per byte).
+         * @param size The size of the framebuffer in bytes.
+         */
+        inline void flush(const uint8_t* buffer, size_t size);
+
+        /**
+         * @brief Copies a region of a framebuffer into the display RAM.
+         * The horizontal bounds are widened to the SSD1322 column granularity (4 pixels), and the region is clipped
+         * to the display size, as the real screen does.
+         * @param buffer Pointer to the full framebuffer (4 bits per pixel, packed: 2 pixels per byte).
+         * @param size The size of the full framebuffer in bytes.
+         * @param x The x-coordinate of the top-left corner of the region, in pixels.
+         * @param y The y-coordinate of the top-left corner of the region, in pixels.
+         * @param width The width of the region in pixels.
+         * @param height The height of the region in pixels.
+         */
+        inline void flushRegion(const uint8_t* buffer, size_t size, size_t x, size_t y, size_t width, size_t height);
+
+        /**
+         * @brief Gets the content of the display RAM, i.e. what the screen would show.
+         * @return The packed pixels of the display.
+         */
+        [[nodiscard]]
+        inline const std::array<uint8_t, DISPLAY_HEIGHT * ROW_BYTES>& getRam() const;
+
+        /**
+         * @brief Gets the measured durations of the flushes.
+         * @return The flush timing counters.
+         */
+        [[nodiscard]]
+        inline const FlushTiming& getFlushTiming() const;
+    };
+
+    // Inline methods implementation
+
+    inline void HeadlessScreen::flush(const uint8_t* buffer, size_t size) {
+        flushRegion(buffer, size, 0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT);
+    }
+
+    inline void HeadlessScreen::flushRegion(const uint8_t* buffer, size_t size, size_t x, size_t y, size_t width, size_t height) {
+        assert(size == ram_.size());
+
+        if (x >= DISPLAY_WIDTH || y >= DISPLAY_HEIGHT) return;
+        width = std::min(width, DISPLAY_WIDTH - x);
+        height = std::min(height, DISPLAY_HEIGHT - y);
+        if (width == 0 || height == 0 || size != ram_.size()) return;
+
+        const auto start = std::chrono::steady_clock::now();
+
+        // Whole columns of 4 pixels, 2 bytes each
+        const size_t firstByte = x / PIXELS_PER_COLUMN * PIXELS_PER_COLUMN / 2;
+        const size_t endByte = ((x + width - 1) / PIXELS_PER_COLUMN + 1) * PIXELS_PER_COLUMN / 2;
+        const size_t rowLength = endByte - firstByte;
+
+        for (size_t row {y}; row < y + height; ++row) {
+            std::memcpy(ram_.data() + row * ROW_BYTES + firstByte, buffer + row * ROW_BYTES + firstByte, rowLength);
+        }
+
+        const size_t bytes = rowLength * height;
+        std::chrono::nanoseconds lineTime {0};
+        if (simulatedSpeedHz_ > 0) {
+            lineTime = std::chrono::nanoseconds{bytes * 8 * 1'000'000'000ULL / simulatedSpeedHz_}; // 8 clock cycles per byte
+            std::this_thread::sleep_until(start + lineTime);
+        }
+
+        const auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+        flushTiming_.flushes++;
+        flushTiming_.bytes += bytes;
+        flushTiming_.last = duration;
+        flushTiming_.max = std::max(flushTiming_.max, duration);
+        flushTiming_.total += duration;
+        flushTiming_.lineTime += lineTime;
+    }
+
+    inline const std::array<uint8_t, HeadlessScreen::DISPLAY_HEIGHT * HeadlessScreen::ROW_BYTES>& HeadlessScreen::getRam() const {
+        return ram_;
+    }
+
+    inline const HeadlessScreen::FlushTiming& HeadlessScreen::getFlushTiming() const {
+        return flushTiming_;
+    }
+
+} // namespace PiAlarm::display
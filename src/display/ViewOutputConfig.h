@@ -1,10 +1,16 @@
 #pragma once
 
 #if defined(DISPLAY_SSD1322)
-    #include "hardware/SSD1322.h"
-    #include "gfx/Canvas.h"
-    using ScreenType = PiAlarm::hardware::SSD1322;  ///< Type for the display controller
-    using RenderType = PiAlarm::gfx::Canvas;        ///< Type for the rendering context
+    #include "gfx/BasicCanvas.h"
+    #include "gfx/SDD1322Buffer.h"
+    #ifdef DISPLAY_HEADLESS
+        #include "display/HeadlessScreen.h"
+        using ScreenType = PiAlarm::display::HeadlessScreen;  ///< Type for the in-memory stand-in of the display controller
+    #else
+        #include "hardware/SSD1322.h"
+        using ScreenType = PiAlarm::hardware::SSD1322;  ///< Type for the display controller
+    #endif
+    using RenderType = PiAlarm::gfx::BasicCanvas<PiAlarm::gfx::SDD1322Buffer>; ///< Type for the rendering context, specialised for the SSD1322 buffer
 #elif defined(DISPLAY_CONSOLE)
     #include <iostream>
     #include <sstream>
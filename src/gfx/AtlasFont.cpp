@@ -0,0 +1,126 @@
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "utf8.h"
+
+#include "AtlasFont.h"
+
+namespace PiAlarm::gfx {
+
+    AtlasFont::AtlasFont(const std::string& atlasPath)
+        : mapping_{nullptr}, mappingSize_{0}, header_{}
+    {
+        int fd = open(atlasPath.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) {
+            throw std::runtime_error("Unable to open font atlas: " + atlasPath);
+        }
+
+        struct stat fileStat {};
+        if (fstat(fd, &fileStat) < 0 || fileStat.st_size < static_cast<off_t>(sizeof(atlas::Header))) {
+            close(fd);
+            throw std::runtime_error("Invalid font atlas: " + atlasPath);
+        }
+
+        mappingSize_ = static_cast<size_t>(fileStat.st_size);
+        void* mapping = mmap(nullptr, mappingSize_, PROT_READ, MAP_PRIVATE, fd, 0);
+        close(fd); // the mapping keeps its own reference to the file
+
+        if (mapping == MAP_FAILED) {
+            throw std::runtime_error("Unable to map font atlas: " + atlasPath);
+        }
+        mapping_ = static_cast<const std::byte*>(mapping);
+
+        try {
+            parseAtlas(atlasPath);
+        }
+        catch (...) {
+            munmap(mapping, mappingSize_);
+            throw;
+        }
+    }
+
+    AtlasFont::~AtlasFont() {
+        if (mapping_) {
+            munmap(const_cast<std::byte*>(mapping_), mappingSize_);
+        }
+    }
+
+    void AtlasFont::parseAtlas(const std::string& atlasPath) {
+        std::memcpy(&header_, mapping_, sizeof(header_));
+
+        if (header_.magic != atlas::MAGIC || header_.version != atlas::VERSION) {
+            throw std::runtime_error("Invalid font atlas header: " + atlasPath);
+        }
+
+        const size_t tableSize = static_cast<size_t>(header_.glyphCount) * sizeof(atlas::GlyphEntry);
+        if (header_.glyphTableOffset % alignof(atlas::GlyphEntry) != 0
+            || header_.glyphTableOffset + tableSize > mappingSize_
+            || static_cast<size_t>(header_.bitmapDataOffset) + header_.bitmapDataSize > mappingSize_)
+        {
+            throw std::runtime_error("Truncated font atlas: " + atlasPath);
+        }
+
+        // the mapping is page-aligned, so the table can be read in place
+        glyphTable_ = {reinterpret_cast<const atlas::GlyphEntry*>(mapping_ + header_.glyphTableOffset), header_.glyphCount};
+        bitmapData_ = {reinterpret_cast<const Pixel*>(mapping_ + header_.bitmapDataOffset), header_.bitmapDataSize};
+
+        for (const auto& entry : glyphTable_) {
+            if (entry.bitmapOffset + static_cast<size_t>(entry.width) * entry.height > bitmapData_.size()) {
+                throw std::runtime_error("Invalid glyph bitmap in font atlas: " + atlasPath);
+            }
+        }
+    }
+
+    const RenderedGlyph& AtlasFont::renderChar(const UTF8Char& utf8Char) {
+        auto it = utf8Char.begin();
+        auto end = utf8Char.end();
+        uint32_t codepoint = utf8::next(it, end); // Decode first char
+
+        return renderChar(codepoint);
+    }
+
+    const RenderedGlyph& AtlasFont::renderChar(UnicodeChar codepoint) {
+        auto it {glyphs_.find(codepoint)};
+        if (it != glyphs_.end()) {
+            return it->second;
+        }
+
+        const auto* entry = findEntry(codepoint);
+        if (!entry) {
+            entry = findEntry('?');
+        }
+
+        auto glyph = entry ? makeGlyph(*entry) : RenderedGlyph{0, 0, 0, Bitmap{}};
+        return glyphs_.emplace(codepoint, std::move(glyph)).first->second;
+    }
+
+    const atlas::GlyphEntry* AtlasFont::findEntry(UnicodeChar codepoint) const {
+        auto it = std::ranges::lower_bound(glyphTable_, codepoint, {}, &atlas::GlyphEntry::codepoint);
+        if (it == glyphTable_.end() || it->codepoint != codepoint) {
+            return nullptr;
+        }
+        return &*it;
+    }
+
+    RenderedGlyph AtlasFont::makeGlyph(const atlas::GlyphEntry& entry) const {
+        RenderedGlyph glyph{
+            entry.bearingX,
+            entry.bearingY,
+            entry.advance,
+            Bitmap{entry.width, entry.height}
+        };
+
+        std::copy_n(
+            bitmapData_.begin() + entry.bitmapOffset,
+            glyph.bitmap.pixels.size(),
+            glyph.bitmap.pixels.begin()
+        );
+
+        return glyph;
+    }
+
+} // namespace PiAlarm::gfx
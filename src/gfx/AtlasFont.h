@@ -0,0 +1,134 @@
+#pragma once
+
+#include <cstddef>
+#include <span>
+#include <string>
+#include <unordered_map>
+
+#include "IFont.h"
+#include "FontAtlas.h"
+
+namespace PiAlarm::gfx {
+
+    /**
+     * @class AtlasFont
+     * @brief Represents a font whose glyphs were rendered at build time into a font atlas.
+     *
+     * The atlas file (see FontAtlas.h) is memory-mapped read-only, so opening a font does not read
+     * nor rasterize anything and does not need FreeType. Only the pages holding the glyphs actually drawn
+     * are loaded by the kernel, and only those glyphs are copied into RenderedGlyph objects, on first use.
+     * Glyphs missing from the atlas are drawn with the '?' glyph, or as an empty glyph if there is none.
+     *
+     * @note This class is not thread-safe, it is intended to be used from the render thread.
+     */
+    class AtlasFont : public IFont {
+        const std::byte* mapping_; ///< Start of the read-only mapping of the atlas file
+        size_t mappingSize_; ///< Size in bytes of the mapping
+        atlas::Header header_; ///< Copy of the atlas header
+        std::span<const atlas::GlyphEntry> glyphTable_; ///< Glyph table, inside the mapping
+        std::span<const Pixel> bitmapData_; ///< Glyph bitmaps, inside the mapping
+        std::unordered_map<UnicodeChar, RenderedGlyph> glyphs_; ///< Glyphs already used, node-based so references stay valid
+
+    public:
+
+        /**
+         * @brief Constructs an AtlasFont object by mapping an atlas file.
+         * @param atlasPath The path to the font atlas file.
+         * @throws std::runtime_error if the file cannot be mapped or is not a valid font atlas.
+         */
+        explicit AtlasFont(const std::string& atlasPath);
+
+        /**
+         * @brief Destructor for AtlasFont.
+         * Unmaps the atlas file.
+         */
+        ~AtlasFont() override;
+
+        AtlasFont(const AtlasFont&) = delete;
+        AtlasFont& operator=(const AtlasFont&) = delete;
+
+        // Inherited from IFont
+        /**
+         * @brief Gets a character from the atlas.
+         * @param utf8Char The character to render, represented as a UTF-8 encoded string.
+         * @return A reference to the RenderedGlyph, valid for the lifetime of the font.
+         */
+        const RenderedGlyph& renderChar(const UTF8Char& utf8Char) override;
+
+        /**
+         * @brief Gets a character from the atlas.
+         * @param codepoint The Unicode codepoint of the character to render.
+         * @return A reference to the RenderedGlyph, valid for the lifetime of the font.
+         */
+        const RenderedGlyph& renderChar(UnicodeChar codepoint) override;
+
+        [[nodiscard]]
+        inline int getAscender() const override;
+        [[nodiscard]]
+        inline int getDescender() const override;
+        [[nodiscard]]
+        inline int getLineHeight() const override;
+
+        /**
+         * @brief Gets the number of glyphs stored in the atlas.
+         * @return The number of entries of the glyph table.
+         */
+        [[nodiscard]]
+        inline size_t getAtlasGlyphCount() const;
+
+        /**
+         * @brief Gets the number of glyphs copied out of the atlas so far.
+         * @return The number of distinct characters already rendered with this font.
+         */
+        [[nodiscard]]
+        inline size_t getLoadedGlyphCount() const;
+
+    private:
+
+        /**
+         * @brief Checks the header and the table of the mapped atlas, then sets up the views on it.
+         * @param atlasPath The path to the font atlas file, for error messages.
+         * @throws std::runtime_error if the atlas is invalid.
+         */
+        void parseAtlas(const std::string& atlasPath);
+
+        /**
+         * @brief Searches a codepoint in the glyph table.
+         * @param codepoint The Unicode codepoint to search.
+         * @return A pointer to the glyph entry, or nullptr if the atlas does not contain the codepoint.
+         */
+        [[nodiscard]]
+        const atlas::GlyphEntry* findEntry(UnicodeChar codepoint) const;
+
+        /**
+         * @brief Copies a glyph out of the atlas.
+         * @param entry The glyph entry to copy.
+         * @return A RenderedGlyph containing the glyph metrics and bitmap.
+         */
+        [[nodiscard]]
+        RenderedGlyph makeGlyph(const atlas::GlyphEntry& entry) const;
+    };
+
+    // inline methods implementation
+
+    inline int AtlasFont::getAscender() const {
+        return header_.ascender;
+    }
+
+    inline int AtlasFont::getDescender() const {
+        return header_.descender;
+    }
+
+    inline int AtlasFont::getLineHeight() const {
+        return header_.lineHeight;
+    }
+
+    inline size_t AtlasFont::getAtlasGlyphCount() const {
+        return glyphTable_.size();
+    }
+
+    inline size_t AtlasFont::getLoadedGlyphCount() const {
+        return glyphs_.size();
+    }
+
+} // namespace PiAlarm::gfx
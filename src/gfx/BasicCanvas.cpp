@@ -0,0 +1,165 @@
+#include <utility>
+#include <algorithm>
+#include <limits>
+#include "utf8.h"
+
+#include "BasicCanvas.h"
+
+namespace PiAlarm::gfx {
+
+    void CanvasBase::layoutText(std::string_view text, IFont& font, std::vector<PositionedGlyph>& glyphs) {
+        glyphs.clear();
+        size_t cursorX = 0;
+
+        auto it = text.begin();
+        auto end = text.end();
+
+        while (it != end) {
+            UnicodeChar codepoint = utf8::next(it, end);
+            glyphs.emplace_back(font.renderChar(codepoint), cursorX);
+            cursorX += glyphs.back().glyph.advance;
+        }
+    }
+
+    std::pair<size_t, size_t> CanvasBase::measureText(const std::vector<PositionedGlyph>& glyphs, const IFont& font) {
+        if (glyphs.empty()) return {0, 0};
+
+        size_t width = glyphs.back().xOffset + glyphs.back().glyph.advance; // offset of the last glyph + its advance
+        size_t height = getMaxAscender(glyphs) - getMaxDescender(glyphs);
+        return {width, height};
+    }
+
+    int CanvasBase::getMaxAscender(const std::vector<PositionedGlyph>& glyphs) {
+        if (glyphs.empty()) return 0;
+
+        return std::ranges::max_element(
+            glyphs,
+            [](const PositionedGlyph& a, const PositionedGlyph& b) {
+                return a.glyph.bearingY < b.glyph.bearingY;
+            })->glyph.bearingY;
+    }
+
+    int CanvasBase::getMaxDescender(const std::vector<PositionedGlyph>& glyphs) {
+        if (glyphs.empty()) return 0;
+
+        // compare signed values, the bitmap height is unsigned
+        auto bottom = [](const PositionedGlyph& g) {
+            return g.glyph.bearingY - static_cast<int>(g.glyph.bitmap.height);
+        };
+
+        auto glyphWithMax = std::ranges::min_element(
+            glyphs,
+            [&bottom](const PositionedGlyph& a, const PositionedGlyph& b) {
+                return bottom(a) < bottom(b);
+            });
+
+        return bottom(*glyphWithMax); // return descender as negative value
+    }
+
+    std::pair<size_t, size_t> CanvasBase::getTextAnchorPosition(
+        size_t x, size_t y,
+        size_t textWidth,
+        int maxBearingY,
+        const IFont& font,
+        Anchor anchor)
+    {
+        size_t drawX = x;
+        size_t baselineY = y;
+        auto ascender = font.getAscender();
+        auto descender = font.getDescender();
+
+        // horizontal offset
+        switch (anchor) {
+            case Anchor::TopCenter:
+            case Anchor::Center:
+            case Anchor::BottomCenter:
+                drawX -= textWidth / 2;
+                break;
+
+            case Anchor::TopRight:
+            case Anchor::MiddleRight:
+            case Anchor::BottomRight:
+                drawX -= textWidth;
+                break;
+
+            default:
+                break; // left = unchanged x
+        }
+
+        // vertical offset
+        switch (anchor) {
+            case Anchor::TopLeft:
+            case Anchor::TopCenter:
+            case Anchor::TopRight:
+                baselineY += maxBearingY;
+                break;
+
+            case Anchor::MiddleLeft:
+            case Anchor::Center:
+            case Anchor::MiddleRight:
+                baselineY += (ascender + descender) / 2; // descender is negative
+                break;
+
+            default:
+                break; // bottom = unchanged y
+        }
+
+        return {drawX, baselineY};
+    }
+
+    Rect CanvasBase::clipBounds(ssize_t left, ssize_t top, ssize_t right, ssize_t bottom, size_t width, size_t height) {
+        left = std::max<ssize_t>(left, 0);
+        top = std::max<ssize_t>(top, 0);
+        right = std::min(right, static_cast<ssize_t>(width));
+        bottom = std::min(bottom, static_cast<ssize_t>(height));
+
+        if (left >= right || top >= bottom) return {};
+
+        return {static_cast<size_t>(left), static_cast<size_t>(top), static_cast<size_t>(right - left), static_cast<size_t>(bottom - top)};
+    }
+
+    Rect CanvasBase::getTextBounds(const std::vector<PositionedGlyph>& glyphs, ssize_t x, ssize_t baselineY, size_t width, size_t height) {
+        ssize_t left {std::numeric_limits<ssize_t>::max()}, top {std::numeric_limits<ssize_t>::max()};
+        ssize_t right {std::numeric_limits<ssize_t>::min()}, bottom {std::numeric_limits<ssize_t>::min()};
+
+        for (const auto& g : glyphs) {
+            const auto& glyph = g.glyph;
+            if (glyph.bitmap.width == 0 || glyph.bitmap.height == 0) continue; // spaces draw nothing
+
+            const ssize_t glyphX = x + static_cast<ssize_t>(g.xOffset) + glyph.bearingX;
+            const ssize_t glyphY = baselineY - glyph.bearingY;
+            left = std::min(left, glyphX);
+            top = std::min(top, glyphY);
+            right = std::max(right, glyphX + static_cast<ssize_t>(glyph.bitmap.width));
+            bottom = std::max(bottom, glyphY + static_cast<ssize_t>(glyph.bitmap.height));
+        }
+
+        if (left > right) return {}; // no visible glyph
+
+        return clipBounds(left, top, right, bottom, width, height);
+    }
+
+    Rect CanvasBase::getDigitTextBounds(ssize_t x, ssize_t baselineY, std::string_view text, const DigitSpriteSheet& digits, size_t width, size_t height) {
+        ssize_t left {std::numeric_limits<ssize_t>::max()}, top {std::numeric_limits<ssize_t>::max()};
+        ssize_t right {std::numeric_limits<ssize_t>::min()}, bottom {std::numeric_limits<ssize_t>::min()};
+
+        for (char c : text) {
+            const auto* cell = digits.findCell(c);
+            if (!cell) continue;
+
+            // cover both sprite variants, the odd one starts a pixel earlier
+            const ssize_t spriteX = x + cell->bearingX;
+            left = std::min(left, spriteX - 1);
+            top = std::min(top, baselineY - cell->bearingY);
+            right = std::max(right, spriteX + static_cast<ssize_t>(cell->sprites[0].width));
+            bottom = std::max(bottom, baselineY - cell->descent);
+
+            x += cell->advance;
+        }
+
+        if (left > right) return {}; // nothing drawn
+
+        return clipBounds(left, top, right, bottom, width, height);
+    }
+
+} // namespace PiAlarm::gfx
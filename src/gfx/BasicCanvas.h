@@ -0,0 +1,747 @@
+#pragma once
+
+#include <memory>
+#include <string_view>
+#include <vector>
+#include <sys/types.h> // For ssize_t
+
+#include "Types.h"
+#include "Bitmap.h"
+#include "DigitSpriteSheet.h"
+#include "DisplayList.h"
+#include "DrawMode.h"
+#include "Sprite.h"
+#include "IBuffer.h"
+#include "IFont.h"
+
+namespace PiAlarm::gfx {
+
+    /**
+     * @class CanvasBase
+     * @brief Holds the types and the text layout logic shared by every canvas.
+     *
+     * This class does not depend on the buffer type, so its code is compiled once
+     * instead of once per BasicCanvas instantiation.
+     *
+     * Text is laid out in a buffer owned by the canvas and reused by every drawText call: the laid-out glyphs
+     * reference the glyphs cached by the font, so once the buffer has grown to the longest text
+     * and the glyphs are cached, drawing text performs no heap allocation.
+     *
+     * It also holds the display lists of the recording mode (see BasicCanvas::setRecording).
+     */
+    class CanvasBase {
+    public:
+        using DrawMode = gfx::DrawMode; ///< Drawing mode of the canvas, see gfx::DrawMode
+
+        /**
+         * @enum Anchor
+         * @brief Specifies the anchor point used to position text on the canvas.
+         *
+         * This enum defines which point of the text bounding box is aligned with the
+         * given (x, y) coordinates in text rendering functions. It provides precise
+         * control over text placement on the screen.
+         */
+        enum class Anchor : uint8_t {
+            TopLeft,       ///< Aligns the top-left corner of the text box with (x, y).
+            MiddleLeft,    ///< Aligns the vertical center of the left edge with (x, y).
+            BottomLeft,    ///< Aligns the bottom-left corner of the text box with (x, y).
+            TopCenter,     ///< Aligns the top-center of the text box with (x, y).
+            Center,        ///< Aligns the center of the text box with (x, y).
+            BottomCenter,  ///< Aligns the bottom-center of the text box with (x, y).
+            TopRight,      ///< Aligns the top-right corner of the text box with (x, y).
+            MiddleRight,   ///< Aligns the vertical center of the right edge with (x, y).
+            BottomRight    ///< Aligns the bottom-right corner of the text box with (x, y).
+        };
+
+        /**
+         * @struct DrawMetrics
+         * @brief Contains metrics for the drawn content on the canvas.
+         *
+         * This structure holds the width and height of the drawn content in pixels.
+         */
+        struct DrawMetrics {
+            size_t width; ///< Width of the drawn content in pixels
+            size_t height; ///< Height of the drawn content in pixels
+        };
+
+    protected:
+        std::vector<PositionedGlyph> textLayout_; ///< Layout of the text being drawn, reused to avoid allocations
+
+        bool recording_ {false}; ///< Whether draw calls are recorded into displayList_ instead of being rasterized
+        bool previousFrameValid_ {false}; ///< Whether the buffer holds the rasterized previousDisplayList_
+        DisplayList displayList_; ///< Draw calls of the frame being recorded
+        DisplayList previousDisplayList_; ///< Draw calls of the last replayed frame, as found in the buffer
+        RegionSet replayRegions_; ///< Regions re-rasterized by the last replay
+
+        /**
+         * @brief Lays out the text by rendering each character and positioning them.
+         * This method processes the input text and fills the given vector with PositionedGlyphs,
+         * which reference the rendered glyphs and hold their respective x-offsets.
+         * @param text The text to layout, UTF-8 encoded.
+         * @param font The Font used to render the text.
+         * @param glyphs The vector receiving the laid-out text. It is cleared first, its capacity is kept.
+         */
+        static void layoutText(std::string_view text, IFont& font, std::vector<PositionedGlyph>& glyphs);
+
+        /**
+         * @brief Measures the width and height of the laid-out text.
+         * This method calculates the total width and height of the text based on the rendered glyphs.
+         * @param glyphs The vector of PositionedGlyphs representing the laid-out text.
+         * @param font The Font used to render the text.
+         * @return A pair containing the width and height of the text in pixels.
+         */
+        static std::pair<size_t, size_t> measureText(const std::vector<PositionedGlyph>& glyphs, const IFont& font);
+
+        /**
+         * @brief Gets the maximum ascender value from the laid-out glyphs.
+         * This method finds the maximum ascender value (bearing Y) of the glyphs,
+         * which is used to adjust the vertical position of the text.
+         * @param glyphs The vector of PositionedGlyphs representing the laid-out text.
+         * @return The maximum ascender value among the glyphs, as a positive integer.
+         */
+        static int getMaxAscender(const std::vector<PositionedGlyph>& glyphs);
+
+        /**
+         * @brief Gets the maximum descender value from the laid-out glyphs.
+         * This method finds the maximum descender value of the glyphs,
+         * calculated as a negative integer representing the distance below the baseline.
+         * It corresponds to the minimal (most negative) value of (bearingY - bitmap height).
+         * This value is used to adjust the vertical position of the text.
+         * @param glyphs The vector of PositionedGlyphs representing the laid-out text.
+         * @return The maximum descender value among the glyphs, as a negative integer.
+         * @warning In this context, "maximum descender" means the glyph that extends the furthest below the baseline,
+         *          so it is the smallest (most negative) value.
+         *          For example, between -1 and -2, the maximum descender is -2.
+         */
+        static int getMaxDescender(const std::vector<PositionedGlyph>& glyphs);
+
+        /**
+         * @brief Calculates the anchor position for text based on the specified anchor type.
+         * This method determines the starting position for drawing text based on the anchor point.
+         * @param x The x-coordinate where the text will be drawn.
+         * @param y The y-coordinate where the text will be drawn.
+         * @param textWidth The width of the text to be drawn.
+         * @param maxBearingY The maximum bearing Y value of the glyphs in the text.
+         *                   This is used to adjust the vertical position of the text.
+         * @param font The Font used to render the text.
+         * @param anchor The Anchor type that specifies how to align the text.
+         * @return A pair containing the adjusted x and y coordinates for drawing the text.
+         */
+        static std::pair<size_t, size_t> getTextAnchorPosition(
+            size_t x, size_t y,
+            size_t textWidth,
+            int maxBearingY,
+            const IFont& font,
+            Anchor anchor
+        );
+
+        /**
+         * @brief Clips a rectangle given by its edges to the canvas.
+         * @param left The x-coordinate of the left edge, may be negative.
+         * @param top The y-coordinate of the top edge, may be negative.
+         * @param right The x-coordinate after the right edge.
+         * @param bottom The y-coordinate after the bottom edge.
+         * @param width The width of the canvas.
+         * @param height The height of the canvas.
+         * @return The part of the rectangle inside the canvas, empty if there is none.
+         */
+        static Rect clipBounds(ssize_t left, ssize_t top, ssize_t right, ssize_t bottom, size_t width, size_t height);
+
+        /**
+         * @brief Gets the pixels covered by laid-out text.
+         * @param glyphs The vector of PositionedGlyphs representing the laid-out text.
+         * @param x The x-coordinate of the pen at the start of the text.
+         * @param baselineY The y-coordinate of the baseline.
+         * @param width The width of the canvas.
+         * @param height The height of the canvas.
+         * @return The bounding box of the glyph bitmaps, clipped to the canvas.
+         */
+        static Rect getTextBounds(const std::vector<PositionedGlyph>& glyphs, ssize_t x, ssize_t baselineY, size_t width, size_t height);
+
+        /**
+         * @brief Gets the pixels covered by a text drawn with a digit sprite sheet.
+         * @param x The x-coordinate of the pen at the start of the text.
+         * @param baselineY The y-coordinate of the baseline.
+         * @param text The text.
+         * @param digits The sprite sheet the text is drawn with.
+         * @param width The width of the canvas.
+         * @param height The height of the canvas.
+         * @return The bounding box of the sprites, clipped to the canvas.
+         */
+        static Rect getDigitTextBounds(ssize_t x, ssize_t baselineY, std::string_view text, const DigitSpriteSheet& digits, size_t width, size_t height);
+    };
+
+    /**
+     * @class BasicCanvas
+     * @brief Represents a drawable canvas over a graphics buffer of a given type.
+     *
+     * This class provides methods to draw on a canvas by manipulating pixels, clear the canvas, and access the underlying buffer.
+     * Every buffer access goes through the Buffer type: instantiated with a concrete, final buffer class
+     * (e.g. SDD1322Buffer), the calls are resolved at compile time and can be inlined.
+     * Instantiated with IBuffer, it is the type-erased Canvas working with any buffer implementation.
+     *
+     * In recording mode, draw calls are recorded into a display list instead of being rasterized.
+     * replay() compares the list with the one of the previous frame and only clears and re-rasterizes
+     * the regions covered by the commands that changed, so a frame where only the seconds changed
+     * only redraws the seconds.
+     *
+     * @tparam Buffer The type of the buffer, IBuffer or a class implementing it.
+     */
+    template<typename Buffer>
+    class BasicCanvas : public CanvasBase {
+    private:
+        std::unique_ptr<Buffer> buffer_; ///< Unique pointer to the buffer used for drawing
+        DrawMode drawMode_; ///< Current drawing mode for the canvas
+
+    public:
+
+        /**
+         * @brief Constructor for BasicCanvas.
+         * Initializes the canvas with a unique pointer to a buffer.
+         * @param buffer Unique pointer to the buffer used for drawing.
+         * @param drawMode The drawing mode for the canvas, default is DrawMode::IgnoreBlack.
+         */
+        explicit BasicCanvas(std::unique_ptr<Buffer> buffer, DrawMode drawMode = DrawMode::IgnoreBlack);
+
+        /**
+         * @brief Sets the drawing mode for the canvas.
+         * @param drawMode The drawing mode to set.
+         */
+        inline void setDrawMode(DrawMode drawMode);
+
+        /**
+         * @brief Gets the current drawing mode of the canvas.
+         * @return The current drawing mode.
+         */
+        [[nodiscard]]
+        inline DrawMode getDrawMode() const;
+
+        /**
+         * @brief Clears the canvas by resetting the buffer.
+         * This method should be called before drawing new content.
+         * In recording mode, the buffer is kept and a new display list is started instead.
+         */
+        inline void clear();
+
+        /**
+         * @brief Enables or disables the recording mode.
+         * In recording mode, draw calls are recorded and only rasterized by replay(). The fonts, sprite sheets,
+         * bitmaps and sprites drawn must stay alive until then. Leaving the recording mode forgets the previous frame.
+         * @param recording True to record the draw calls, false to rasterize them immediately.
+         */
+        inline void setRecording(bool recording);
+
+        /**
+         * @brief Checks if the canvas is in recording mode.
+         * @return True if draw calls are recorded.
+         */
+        [[nodiscard]]
+        inline bool isRecording() const;
+
+        /**
+         * @brief Rasterizes the frame recorded since the last clear().
+         * Only the regions where the frame differs from the previous replayed frame are cleared and redrawn,
+         * with every command of the frame that touches them. The first frame is fully redrawn.
+         * Does nothing outside of the recording mode.
+         * @return The regions that were redrawn, valid until the next replay.
+         */
+        const RegionSet& replay();
+
+        /**
+         * @brief Sets a pixel in the canvas at the specified coordinates.
+         * @param x The x-coordinate of the pixel (horizontal position).
+         * @param y The y-coordinate of the pixel (vertical position).
+         * @param grayscale The grayscale value to set for the pixel (0-255).
+         */
+        inline void drawPixel(size_t x, size_t y, Pixel grayscale);
+
+        /**
+         * @brief Draws a rectangle on the canvas at the specified coordinates.
+         * @param x The x-coordinate of the top-left corner of the rectangle.
+         * @param y The y-coordinate of the top-left corner of the rectangle.
+         * @param w The width of the rectangle.
+         * @param h The height of the rectangle.
+         * @param thickness The thickness of the rectangle's border (default is 1 pixel).
+         * @param color The color of the rectangle's border (default is white, represented by 255).
+         */
+        void drawRectangle(size_t x, size_t y, size_t w, size_t h, size_t thickness = 1, Pixel color = 255);
+
+        /**
+         * @brief Draws a bitmap at the specified coordinates on the canvas.
+         * The bitmap is clipped once and written row by row by the buffer, using the current drawing mode.
+         * @param x The x-coordinate where the bitmap will be drawn.
+         * @param y The y-coordinate where the bitmap will be drawn.
+         * @param bitmap The Bitmap object to draw on the canvas.
+         */
+        inline void drawBitmap(size_t x, size_t y, const Bitmap& bitmap);
+
+        /**
+         * @brief Draws a sprite at the specified coordinates on the canvas.
+         * The sprite is already packed and inverted at build time, so the drawing mode is not applied:
+         * opaque pixels are copied as is and transparent ones keep the canvas content.
+         * @param x The x-coordinate where the sprite will be drawn.
+         * @param y The y-coordinate where the sprite will be drawn.
+         * @param sprite The Sprite to draw on the canvas.
+         */
+        inline void drawSprite(size_t x, size_t y, const Sprite& sprite);
+
+        /**
+         * @brief Draws a character at the specified coordinates using the provided font.
+         * @param x The x-coordinate where the character will be drawn.
+         * @param y The y-coordinate where the character will be drawn.
+         * @param utf8Char The character to draw, represented as a UTF-8 encoded string.
+         * @param font The Font used to render the character.
+         */
+        void drawChar(size_t x, size_t y, const UTF8Char& utf8Char, IFont& font);
+
+        /**
+         * @brief Draws UTF-8 text on the canvas with the specified anchor alignment.
+         *
+         * Renders a  string on the canvas using the provided font,
+         * with the given (x, y) coordinate interpreted according to the specified anchor.
+         * The anchor defines how the text is aligned relative to (x, y), allowing precise
+         * positioning in various layouts (e.g., top-left, center, bottom-right, etc.).
+         *
+         * @param x The horizontal position, interpreted based on the anchor.
+         * @param y The vertical position, interpreted based on the anchor.
+         * @param text The text to draw.
+         * @param font The font used to render the text.
+         * @param anchor The anchor point that determines how the text is aligned
+         *               relative to (x, y). Defaults to Anchor::TopLeft.
+         *
+         * @return DrawMetrics containing the width and height of the rendered text.
+         *
+         * @see Anchor for available alignment options.
+         */
+        DrawMetrics drawText(size_t x, size_t y, std::string_view text, const std::shared_ptr<IFont>& font, Anchor anchor = Anchor::TopLeft);
+
+        /**
+         * @brief Draws digits on the canvas from a pre-rendered sprite sheet, with the specified anchor alignment.
+         *
+         * Works like drawText with the font of the sheet, but each character is a sprite copied row by row,
+         * already aligned on the packed pixels of the buffer. Characters that are not in the sheet are ignored.
+         * The drawing mode is not applied, see DigitSpriteSheet.
+         *
+         * @param x The horizontal position, interpreted based on the anchor.
+         * @param y The vertical position, interpreted based on the anchor.
+         * @param text The text to draw, made of digits and colons.
+         * @param digits The sprite sheet holding the pre-rendered characters.
+         * @param anchor The anchor point that determines how the text is aligned
+         *               relative to (x, y). Defaults to Anchor::TopLeft.
+         *
+         * @return DrawMetrics containing the width and height of the rendered text.
+         */
+        DrawMetrics drawText(size_t x, size_t y, std::string_view text, const DigitSpriteSheet& digits, Anchor anchor = Anchor::TopLeft);
+
+        /**
+         * @brief Gets the buffer used for drawing.
+         * @return A constant reference to the buffer instance.
+         */
+        [[nodiscard]]
+        inline const Buffer& buffer() const;
+
+        /**
+         * @brief Gets the buffer used for drawing.
+         * @return A reference to the buffer instance, e.g. to mark it as flushed.
+         */
+        [[nodiscard]]
+        inline Buffer& buffer();
+
+        /**
+         * @brief Gets the width of the buffer in pixels.
+         * @return The width of the buffer in pixels.
+         */
+        [[nodiscard]]
+        constexpr size_t getWidth() const;
+
+        /**
+         * @brief Gets the height of the buffer in pixels.
+         * @return The height of the buffer in pixels.
+         */
+        [[nodiscard]]
+        constexpr size_t getHeight() const;
+
+    private:
+
+        /**
+         * @brief Records a draw call into the display list of the frame.
+         * @param command The command to record, with the current drawing mode.
+         * @param text The text drawn by the command, if any.
+         */
+        inline void record(DrawCommand command, std::string_view text = {});
+
+        /**
+         * @brief Rasterizes a recorded draw call.
+         * @param command The command to rasterize, from displayList_.
+         */
+        void rasterize(const DrawCommand& command);
+
+        /**
+         * @brief Rasterizes the border of a rectangle, see drawRectangle.
+         */
+        void rasterizeRectangle(size_t x, size_t y, size_t w, size_t h, size_t thickness, Pixel color);
+
+        /**
+         * @brief Rasterizes text with a digit sprite sheet.
+         * @param penX The x-coordinate of the pen at the start of the text.
+         * @param baselineY The y-coordinate of the baseline.
+         * @param text The text to draw.
+         * @param digits The sprite sheet holding the pre-rendered characters.
+         */
+        void rasterizeDigits(ssize_t penX, ssize_t baselineY, std::string_view text, const DigitSpriteSheet& digits);
+
+        /**
+         * @brief Draws a glyph at the specified coordinates.
+         * This method is used internally to draw a rendered glyph on the canvas.
+         * @param x The x-coordinate where the glyph will be drawn.
+         * @param baselineY The y-coordinate of the baseline for the glyph.
+         * @param glyph The RenderedGlyph object containing the glyph data to draw.
+         */
+        inline void drawGlyph(size_t x, size_t baselineY, const RenderedGlyph& glyph);
+
+        /**
+         * @brief Sets a pixel in the buffer at the specified coordinates.
+         * This method applies the current drawing mode before setting the pixel value.
+         * @param x The x-coordinate of the pixel (horizontal position).
+         * @param y The y-coordinate of the pixel (vertical position).
+         * @param value The pixel value to set (0-255).
+         */
+        inline void setPixel(size_t x, size_t y, Pixel value);
+    };
+
+    // Template methods implementation
+
+    template<typename Buffer>
+    BasicCanvas<Buffer>::BasicCanvas(std::unique_ptr<Buffer> buffer, DrawMode drawMode)
+        : buffer_{std::move(buffer)}, drawMode_{drawMode}
+    {}
+
+    template<typename Buffer>
+    inline void BasicCanvas<Buffer>::setDrawMode(DrawMode drawMode) {
+        drawMode_ = drawMode;
+    }
+
+    template<typename Buffer>
+    inline typename BasicCanvas<Buffer>::DrawMode BasicCanvas<Buffer>::getDrawMode() const {
+        return drawMode_;
+    }
+
+    template<typename Buffer>
+    inline void BasicCanvas<Buffer>::clear() {
+        if (recording_) {
+            displayList_.clear(); // the buffer still holds the previous frame, replay() updates what changed
+            return;
+        }
+        buffer_->clear();
+    }
+
+    template<typename Buffer>
+    inline void BasicCanvas<Buffer>::setRecording(bool recording) {
+        recording_ = recording;
+        previousFrameValid_ = false;
+        displayList_.clear();
+        previousDisplayList_.clear();
+    }
+
+    template<typename Buffer>
+    inline bool BasicCanvas<Buffer>::isRecording() const {
+        return recording_;
+    }
+
+    template<typename Buffer>
+    const RegionSet& BasicCanvas<Buffer>::replay() {
+        replayRegions_.clear();
+        if (!recording_) return replayRegions_;
+
+        if (previousFrameValid_) {
+            DisplayList::diff(previousDisplayList_, displayList_, replayRegions_);
+        } else {
+            replayRegions_.add({0, 0, getWidth(), getHeight()});
+        }
+
+        const auto savedDrawMode = drawMode_;
+
+        for (const auto& region : replayRegions_) {
+            buffer_->clearRegion(region);
+            buffer_->setClipRegion(region);
+
+            // redraw, in order, every command touching the region; the clip keeps the pixels around it untouched
+            for (const auto& command : displayList_.getCommands()) {
+                if (RegionSet::intersects(command.bounds, region)) {
+                    rasterize(command);
+                }
+            }
+        }
+
+        buffer_->resetClipRegion();
+        drawMode_ = savedDrawMode;
+
+        std::swap(previousDisplayList_, displayList_);
+        previousFrameValid_ = true;
+
+        return replayRegions_;
+    }
+
+    template<typename Buffer>
+    inline void BasicCanvas<Buffer>::record(DrawCommand command, std::string_view text) {
+        command.drawMode = drawMode_;
+        displayList_.add(command, text);
+    }
+
+    template<typename Buffer>
+    void BasicCanvas<Buffer>::rasterize(const DrawCommand& command) {
+        using Type = DrawCommand::Type;
+        drawMode_ = command.drawMode;
+
+        switch (command.type) {
+            case Type::Pixel:
+                setPixel(command.x, command.y, command.color);
+                break;
+            case Type::Rectangle:
+                rasterizeRectangle(command.x, command.y, command.width, command.height, command.thickness, command.color);
+                break;
+            case Type::Bitmap:
+                buffer_->blit(command.x, command.y, *static_cast<const Bitmap*>(command.source), drawMode_);
+                break;
+            case Type::Sprite:
+                buffer_->blitSprite(command.x, command.y, *static_cast<const Sprite*>(command.source));
+                break;
+            case Type::Text:
+                layoutText(displayList_.getText(command), *static_cast<IFont*>(const_cast<void*>(command.source)), textLayout_);
+                for (const auto& g : textLayout_) {
+                    drawGlyph(command.x + g.xOffset, command.y, g.glyph);
+                }
+                break;
+            case Type::DigitText:
+                rasterizeDigits(command.x, command.y, displayList_.getText(command), *static_cast<const DigitSpriteSheet*>(command.source));
+                break;
+        }
+    }
+
+    template<typename Buffer>
+    inline void BasicCanvas<Buffer>::drawPixel(size_t x, size_t y, Pixel grayscale) {
+        if (recording_) {
+            const auto px = static_cast<ssize_t>(x), py = static_cast<ssize_t>(y);
+            record({
+                .type = DrawCommand::Type::Pixel, .drawMode = drawMode_, .color = grayscale, .x = px, .y = py,
+                .bounds = clipBounds(px, py, px + 1, py + 1, getWidth(), getHeight())
+            });
+            return;
+        }
+        setPixel(x, y, grayscale);
+    }
+
+    template<typename Buffer>
+    // NOLINTNEXTLINE(readability-make-member-function-const)
+    inline void BasicCanvas<Buffer>::setPixel(size_t x, size_t y, Pixel value) {
+        uint8_t finalValue {value};
+
+        switch (drawMode_) {
+            case DrawMode::DisplayAll:
+                break;
+            case DrawMode::IgnoreBlack:
+                if (value == 0) return;
+                break;
+            case DrawMode::Invert:
+                if (value == 255) return; // will become black
+            case DrawMode::InvertAndDisplayAll:
+                finalValue = 255 - value;
+                break;
+        }
+
+        buffer_->setPixel(x, y, finalValue);
+    }
+
+    template<typename Buffer>
+    void BasicCanvas<Buffer>::drawRectangle(size_t x, size_t y, size_t w, size_t h, size_t thickness, Pixel color) {
+        if (w <= 0 || h <= 0 || thickness <= 0) return;
+
+        if (recording_) {
+            const auto left = static_cast<ssize_t>(x), top = static_cast<ssize_t>(y);
+            const auto right = left + static_cast<ssize_t>(w), bottom = top + static_cast<ssize_t>(h);
+            const auto border = static_cast<ssize_t>(thickness);
+            // a border thicker than the rectangle goes past its opposite side
+            record({
+                .type = DrawCommand::Type::Rectangle, .drawMode = drawMode_, .color = color, .x = left, .y = top,
+                .width = w, .height = h, .thickness = thickness,
+                .bounds = clipBounds(std::min(left, right - border), std::min(top, bottom - border),
+                                     std::max(right, left + border), std::max(bottom, top + border), getWidth(), getHeight())
+            });
+            return;
+        }
+
+        rasterizeRectangle(x, y, w, h, thickness, color);
+    }
+
+    template<typename Buffer>
+    void BasicCanvas<Buffer>::rasterizeRectangle(size_t x, size_t y, size_t w, size_t h, size_t thickness, Pixel color) {
+        // Top
+        for (size_t i {x}; i < x + w; ++i) {
+            for (size_t t {0}; t < thickness; ++t) {
+                setPixel(i, y + t, color);
+            }
+        }
+        // Bottom
+        for (size_t i {x}; i < x + w; ++i) {
+            for (size_t t {0}; t < thickness; ++t) {
+                setPixel(i, y + h - 1 - t, color);
+            }
+        }
+        // Left
+        for (size_t j {y}; j < y + h; ++j) {
+            for (size_t t {0}; t < thickness; ++t) {
+                setPixel(x + t, j, color);
+            }
+        }
+        // Right
+        for (size_t j {y}; j < y + h; ++j) {
+            for (size_t t {0}; t < thickness; ++t) {
+                setPixel(x + w - 1 - t, j, color);
+            }
+        }
+    }
+
+    template<typename Buffer>
+    inline void BasicCanvas<Buffer>::drawBitmap(size_t x, size_t y, const Bitmap &bitmap) {
+        // Coordinates computed from negative bearings wrap around, get them back as signed values
+        const auto left = static_cast<ssize_t>(x), top = static_cast<ssize_t>(y);
+
+        if (recording_) {
+            record({
+                .type = DrawCommand::Type::Bitmap, .drawMode = drawMode_, .x = left, .y = top, .source = &bitmap,
+                .contentHash = DisplayList::hashPixels(bitmap.pixels.data(), bitmap.pixels.size()),
+                .bounds = clipBounds(left, top, left + static_cast<ssize_t>(bitmap.width), top + static_cast<ssize_t>(bitmap.height), getWidth(), getHeight())
+            });
+            return;
+        }
+
+        buffer_->blit(left, top, bitmap, drawMode_);
+    }
+
+    template<typename Buffer>
+    inline void BasicCanvas<Buffer>::drawSprite(size_t x, size_t y, const Sprite& sprite) {
+        const auto left = static_cast<ssize_t>(x), top = static_cast<ssize_t>(y);
+
+        if (recording_) {
+            record({
+                .type = DrawCommand::Type::Sprite, .drawMode = drawMode_, .x = left, .y = top, .source = &sprite,
+                .bounds = clipBounds(left, top, left + static_cast<ssize_t>(sprite.width), top + static_cast<ssize_t>(sprite.height), getWidth(), getHeight())
+            });
+            return;
+        }
+
+        buffer_->blitSprite(left, top, sprite);
+    }
+
+    template<typename Buffer>
+    void BasicCanvas<Buffer>::drawChar(size_t x, size_t y, const UTF8Char& utf8Char, IFont& font) {
+        const size_t baselineY = y + font.getAscender();
+
+        if (recording_) {
+            layoutText(utf8Char, font, textLayout_); // replayed as a one-character text
+            const auto penX = static_cast<ssize_t>(x), baseline = static_cast<ssize_t>(baselineY);
+            record({
+                .type = DrawCommand::Type::Text, .drawMode = drawMode_, .x = penX, .y = baseline, .source = &font,
+                .bounds = getTextBounds(textLayout_, penX, baseline, getWidth(), getHeight())
+            }, utf8Char);
+            return;
+        }
+
+        drawGlyph(x, baselineY, font.renderChar(utf8Char));
+    }
+
+    template<typename Buffer>
+    inline void BasicCanvas<Buffer>::drawGlyph(size_t x, size_t baselineY, const RenderedGlyph &glyph) {
+        const size_t drawX = x + glyph.bearingX;
+        const size_t drawY = baselineY - glyph.bearingY;
+
+        // Coordinates computed from negative bearings wrap around, get them back as signed values
+        buffer_->blit(static_cast<ssize_t>(drawX), static_cast<ssize_t>(drawY), glyph.bitmap, drawMode_);
+    }
+
+    template<typename Buffer>
+    typename BasicCanvas<Buffer>::DrawMetrics BasicCanvas<Buffer>::drawText(size_t x, size_t y, std::string_view text, const std::shared_ptr<IFont>& font, Anchor anchor) {
+        auto& glyphs = textLayout_;
+        layoutText(text, *font, glyphs);
+
+        // get measures of the text
+        auto [textWidth, textHeight] = measureText(glyphs, *font);
+        auto maxBearingY = getMaxAscender(glyphs);
+
+        // Adjust the x and y coordinates based on the anchor
+        auto [drawX, baselineY] = getTextAnchorPosition(x, y, textWidth, maxBearingY, *font, anchor);
+
+        if (recording_) {
+            const auto penX = static_cast<ssize_t>(drawX), baseline = static_cast<ssize_t>(baselineY);
+            record({
+                .type = DrawCommand::Type::Text, .drawMode = drawMode_, .x = penX, .y = baseline, .source = font.get(),
+                .bounds = getTextBounds(glyphs, penX, baseline, getWidth(), getHeight())
+            }, text);
+            return {textWidth, textHeight};
+        }
+
+        // Draw the text
+        for (const auto& g : glyphs) {
+            drawGlyph(drawX + g.xOffset, baselineY, g.glyph);
+        }
+
+        return {textWidth, textHeight};
+    }
+
+    template<typename Buffer>
+    typename BasicCanvas<Buffer>::DrawMetrics BasicCanvas<Buffer>::drawText(size_t x, size_t y, std::string_view text, const DigitSpriteSheet& digits, Anchor anchor) {
+        const auto metrics = digits.measure(text);
+
+        // Adjust the x and y coordinates based on the anchor, as for a text drawn with the font
+        auto [drawX, baselineY] = getTextAnchorPosition(x, y, metrics.width, metrics.maxAscender, *digits.getFont(), anchor);
+        const auto penX = static_cast<ssize_t>(drawX), baseline = static_cast<ssize_t>(baselineY);
+
+        if (recording_) {
+            record({
+                .type = DrawCommand::Type::DigitText, .drawMode = drawMode_, .x = penX, .y = baseline, .source = &digits,
+                .bounds = getDigitTextBounds(penX, baseline, text, digits, getWidth(), getHeight())
+            }, text);
+        } else {
+            rasterizeDigits(penX, baseline, text, digits);
+        }
+
+        return {metrics.width, static_cast<size_t>(metrics.maxAscender - metrics.maxDescender)};
+    }
+
+    template<typename Buffer>
+    void BasicCanvas<Buffer>::rasterizeDigits(ssize_t penX, ssize_t baselineY, std::string_view text, const DigitSpriteSheet& digits) {
+        for (char c : text) {
+            const auto* cell = digits.findCell(c);
+            if (!cell) continue;
+
+            // use the sprite shifted by a pixel at odd positions, so the rows are copied on whole bytes
+            const ssize_t spriteX = penX + cell->bearingX;
+            const ssize_t spriteY = baselineY - cell->bearingY;
+            const size_t odd = spriteX & 1;
+            buffer_->blitSprite(spriteX - static_cast<ssize_t>(odd), spriteY, cell->sprites[odd]);
+
+            penX += cell->advance;
+        }
+    }
+
+    template<typename Buffer>
+    inline const Buffer& BasicCanvas<Buffer>::buffer() const {
+        return *buffer_;
+    }
+
+    template<typename Buffer>
+    inline Buffer& BasicCanvas<Buffer>::buffer() {
+        return *buffer_;
+    }
+
+    template<typename Buffer>
+    constexpr size_t BasicCanvas<Buffer>::getWidth() const {
+        return buffer_->getWidth();
+    }
+
+    template<typename Buffer>
+    constexpr size_t BasicCanvas<Buffer>::getHeight() const {
+        return buffer_->getHeight();
+    }
+
+} // namespace PiAlarm::gfx
@@ -0,0 +1,78 @@
+#include <algorithm>
+#include <limits>
+
+#include "DigitSpriteSheet.h"
+
+namespace PiAlarm::gfx {
+
+    DigitSpriteSheet::DigitSpriteSheet(std::shared_ptr<IFont> font)
+        : font_{std::move(font)}
+    {
+        // Digits are tabular: they all take the advance of the widest one
+        ssize_t digitAdvance {0};
+        for (char c : CHARACTERS.substr(0, 10)) {
+            digitAdvance = std::max(digitAdvance, font_->renderChar(static_cast<UnicodeChar>(c)).advance);
+        }
+
+        for (size_t i {0}; i < CHARACTERS.size(); ++i) {
+            const auto& glyph = font_->renderChar(static_cast<UnicodeChar>(CHARACTERS[i]));
+            auto& cell = cells_[i];
+            const bool isDigit = i < 10;
+
+            cell.advance = isDigit ? digitAdvance : glyph.advance;
+            cell.bearingX = glyph.bearingX + static_cast<int>(isDigit ? (digitAdvance - glyph.advance) / 2 : 0);
+            cell.bearingY = glyph.bearingY;
+            cell.descent = glyph.bearingY - static_cast<int>(glyph.bitmap.height);
+
+            packSprites(glyph.bitmap, cell);
+        }
+    }
+
+    DigitSpriteSheet::Metrics DigitSpriteSheet::measure(std::string_view text) const {
+        Metrics metrics{0, std::numeric_limits<int>::min(), std::numeric_limits<int>::max()};
+
+        for (char c : text) {
+            const auto* cell = findCell(c);
+            if (!cell) continue;
+
+            metrics.width += cell->advance;
+            metrics.maxAscender = std::max(metrics.maxAscender, cell->bearingY);
+            metrics.maxDescender = std::min(metrics.maxDescender, cell->descent);
+        }
+
+        if (metrics.width == 0) return {0, 0, 0}; // nothing drawn
+
+        return metrics;
+    }
+
+    void DigitSpriteSheet::packSprites(const Bitmap& bitmap, Cell& cell) {
+        const size_t width = bitmap.width;
+        const size_t height = bitmap.height;
+
+        // Sprite 0 starts at the glyph first column, sprite 1 has an extra transparent column on the left
+        const std::array<size_t, 2> rowBytes {(width + 1) / 2, (width + 2) / 2};
+        const std::array<size_t, 2> planeSize {rowBytes[0] * height, rowBytes[1] * height};
+
+        // storage layout: pixels 0, mask 0, pixels 1, mask 1
+        cell.storage.assign(2 * (planeSize[0] + planeSize[1]), 0);
+        std::array<uint8_t*, 2> pixels {cell.storage.data(), cell.storage.data() + 2 * planeSize[0]};
+        std::array<uint8_t*, 2> masks {pixels[0] + planeSize[0], pixels[1] + planeSize[1]};
+
+        for (size_t shift {0}; shift < 2; ++shift) {
+            for (size_t y {0}; y < height; ++y) {
+                for (size_t x {0}; x < width; ++x) {
+                    const Pixel value = bitmap.getPixel(x, y);
+                    if (value == 0) continue; // transparent, as with DrawMode::IgnoreBlack
+
+                    const size_t col = x + shift;
+                    const int nibbleShift = (col % 2 == 0) ? 4 : 0; // even column in the high nibble
+                    pixels[shift][y * rowBytes[shift] + col / 2] |= (value / 16) << nibbleShift;
+                    masks[shift][y * rowBytes[shift] + col / 2] |= 0b0000'1111 << nibbleShift;
+                }
+            }
+
+            cell.sprites[shift] = Sprite{width + shift, height, pixels[shift], masks[shift]};
+        }
+    }
+
+} // namespace PiAlarm::gfx
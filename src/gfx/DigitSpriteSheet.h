@@ -0,0 +1,117 @@
+#pragma once
+
+#include <array>
+#include <memory>
+#include <string_view>
+#include <vector>
+#include <sys/types.h> // For ssize_t
+
+#include "IFont.h"
+#include "Sprite.h"
+
+namespace PiAlarm::gfx {
+
+    /**
+     * @class DigitSpriteSheet
+     * @brief Pre-rendered digits and colon of a font, for texts redrawn every second such as a clock.
+     *
+     * The characters '0' to '9' and ':' are rendered once with the font and converted into sprites
+     * (see Sprite), so drawing a digit is a masked copy of a few bytes per row, without rasterization,
+     * layout nor per-pixel conversion. Each character is stored twice: once for an even x position and once
+     * shifted by one pixel for an odd one, so its rows always fall on whole bytes of the display buffer.
+     *
+     * Digits share the same advance, the widest one of the font, and are centered in it:
+     * the width of a time does not change from one second to the next.
+     *
+     * Pixels are drawn as with DrawMode::IgnoreBlack: black pixels of the glyphs keep the canvas content.
+     */
+    class DigitSpriteSheet {
+    public:
+        static constexpr std::string_view CHARACTERS {"0123456789:"}; ///< Characters available in the sheet
+
+        /**
+         * @struct Cell
+         * @brief A character of the sheet, with its metrics and its sprites.
+         */
+        struct Cell {
+            int bearingX {0}; ///< The horizontal offset from the pen position to the left side of the sprite
+            int bearingY {0}; ///< The vertical offset from the baseline to the top of the sprite
+            int descent {0}; ///< The vertical offset from the baseline to the bottom of the sprite (negative below)
+            ssize_t advance {0}; ///< The horizontal advance to the next character
+            std::vector<uint8_t> storage; ///< Packed pixels and masks of both sprites
+            std::array<Sprite, 2> sprites {}; ///< Sprite drawn at an even x, and the one shifted by a pixel drawn at the previous even x
+        };
+
+        /**
+         * @struct Metrics
+         * @brief Dimensions of a text drawn with the sheet.
+         */
+        struct Metrics {
+            size_t width; ///< Sum of the advances of the characters
+            int maxAscender; ///< Highest bearing Y of the characters
+            int maxDescender; ///< Lowest bottom of the characters, negative below the baseline
+        };
+
+    private:
+        std::shared_ptr<IFont> font_; ///< Font the characters were rendered with, used for its line metrics
+        std::array<Cell, CHARACTERS.size()> cells_; ///< Pre-rendered characters, in the order of CHARACTERS
+
+    public:
+
+        /**
+         * @brief Renders the characters of the sheet with the given font.
+         * @param font The font to render the characters with.
+         * @throws std::runtime_error if a character cannot be rendered.
+         */
+        explicit DigitSpriteSheet(std::shared_ptr<IFont> font);
+
+        DigitSpriteSheet(const DigitSpriteSheet&) = delete; // the sprites point into the cells storage
+        DigitSpriteSheet& operator=(const DigitSpriteSheet&) = delete;
+
+        /**
+         * @brief Gets the font the sheet was rendered with.
+         * @return A reference to the shared pointer to the font.
+         */
+        [[nodiscard]]
+        inline const std::shared_ptr<IFont>& getFont() const;
+
+        /**
+         * @brief Gets the pre-rendered cell of a character.
+         * @param c The character.
+         * @return A pointer to the cell, or nullptr if the character is not in the sheet.
+         */
+        [[nodiscard]]
+        inline const Cell* findCell(char c) const;
+
+        /**
+         * @brief Measures a text drawn with the sheet.
+         * Characters that are not in the sheet are ignored.
+         * @param text The text to measure.
+         * @return The width and the vertical extent of the text.
+         */
+        [[nodiscard]]
+        Metrics measure(std::string_view text) const;
+
+    private:
+
+        /**
+         * @brief Packs a glyph bitmap into the sprites of a cell.
+         * @param bitmap The 8-bit glyph bitmap.
+         * @param cell The cell receiving the storage and the sprites.
+         */
+        static void packSprites(const Bitmap& bitmap, Cell& cell);
+    };
+
+    // Inline methods implementation
+
+    inline const std::shared_ptr<IFont>& DigitSpriteSheet::getFont() const {
+        return font_;
+    }
+
+    inline const DigitSpriteSheet::Cell* DigitSpriteSheet::findCell(char c) const {
+        if (c >= '0' && c <= '9') return &cells_[c - '0'];
+        if (c == ':') return &cells_[10];
+        return nullptr;
+    }
+
+} // namespace PiAlarm::gfx
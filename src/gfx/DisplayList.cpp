@@ -0,0 +1,120 @@
+#include <algorithm>
+#include <cstring>
+
+#include "DisplayList.h"
+
+namespace PiAlarm::gfx {
+
+    namespace {
+
+        constexpr uint64_t FNV_OFFSET_BASIS {0xCBF2'9CE4'8422'2325};
+        constexpr uint64_t FNV_PRIME {0x0000'0100'0000'01B3};
+
+        template<typename T>
+        uint64_t hashValue(uint64_t hash, const T& value) {
+            unsigned char bytes[sizeof(T)];
+            std::memcpy(bytes, &value, sizeof(T));
+            for (unsigned char byte : bytes) {
+                hash = (hash ^ byte) * FNV_PRIME;
+            }
+            return hash;
+        }
+
+    } // namespace
+
+    void DisplayList::clear() {
+        commands_.clear();
+        text_.clear();
+        index_.clear();
+    }
+
+    void DisplayList::add(DrawCommand command, std::string_view text) {
+        command.textOffset = text_.size();
+        command.textLength = text.size();
+        command.hash = hashCommand(command, text);
+
+        text_.append(text);
+        commands_.push_back(command);
+    }
+
+    void DisplayList::diff(DisplayList& previous, DisplayList& current, RegionSet& regions) {
+        // Fast path: the same commands in the same order
+        if (previous.commands_.size() == current.commands_.size()
+            && std::ranges::equal(previous.commands_, current.commands_, [&](const DrawCommand& a, const DrawCommand& b) {
+                return isSameCommand(a, previous, b, current);
+            }))
+        {
+            return;
+        }
+
+        previous.buildIndex();
+        current.buildIndex();
+
+        // removed commands leave their pixels, new ones add theirs
+        for (const auto& command : previous.commands_) {
+            if (!current.contains(previous, command)) regions.add(command.bounds);
+        }
+        for (const auto& command : current.commands_) {
+            if (!previous.contains(current, command)) regions.add(command.bounds);
+        }
+    }
+
+    uint64_t DisplayList::hashPixels(const Pixel* pixels, size_t count) {
+        uint64_t hash {FNV_OFFSET_BASIS};
+        for (size_t i {0}; i < count; ++i) {
+            hash = (hash ^ pixels[i]) * FNV_PRIME;
+        }
+        return hash;
+    }
+
+    void DisplayList::buildIndex() {
+        index_.clear();
+        for (size_t i {0}; i < commands_.size(); ++i) {
+            index_.emplace_back(commands_[i].hash, i);
+        }
+        std::ranges::sort(index_);
+    }
+
+    bool DisplayList::contains(const DisplayList& other, const DrawCommand& command) const {
+        auto it = std::ranges::lower_bound(index_, std::pair<uint64_t, size_t>{command.hash, 0});
+
+        for (; it != index_.end() && it->first == command.hash; ++it) {
+            if (isSameCommand(commands_[it->second], *this, command, other)) return true;
+        }
+        return false;
+    }
+
+    bool DisplayList::isSameCommand(const DrawCommand& a, const DisplayList& listA, const DrawCommand& b, const DisplayList& listB) {
+        return a.hash == b.hash
+            && a.type == b.type
+            && a.drawMode == b.drawMode
+            && a.color == b.color
+            && a.x == b.x && a.y == b.y
+            && a.width == b.width && a.height == b.height
+            && a.thickness == b.thickness
+            && a.source == b.source
+            && a.contentHash == b.contentHash
+            && a.bounds == b.bounds
+            && listA.getText(a) == listB.getText(b);
+    }
+
+    uint64_t DisplayList::hashCommand(const DrawCommand& command, std::string_view text) {
+        uint64_t hash {FNV_OFFSET_BASIS};
+        hash = hashValue(hash, command.type);
+        hash = hashValue(hash, command.drawMode);
+        hash = hashValue(hash, command.color);
+        hash = hashValue(hash, command.x);
+        hash = hashValue(hash, command.y);
+        hash = hashValue(hash, command.width);
+        hash = hashValue(hash, command.height);
+        hash = hashValue(hash, command.thickness);
+        hash = hashValue(hash, command.source);
+        hash = hashValue(hash, command.contentHash);
+
+        for (char c : text) {
+            hash = (hash ^ static_cast<unsigned char>(c)) * FNV_PRIME;
+        }
+        return hash;
+    }
+
+} // namespace PiAlarm::gfx
@@ -0,0 +1,165 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include <sys/types.h> // For ssize_t
+
+#include "Types.h"
+#include "DrawMode.h"
+#include "Rect.h"
+#include "RegionSet.h"
+
+namespace PiAlarm::gfx {
+
+    /**
+     * @struct DrawCommand
+     * @brief A draw call recorded by a canvas, with everything needed to replay it.
+     *
+     * Positions are stored after anchoring (the pen position and baseline for texts), so replaying
+     * a command does not depend on the rest of the frame. The drawn object (font, sprite sheet, bitmap, sprite)
+     * is referenced, not copied: it must stay alive until the frame is replayed.
+     */
+    struct DrawCommand {
+
+        /**
+         * @enum Type
+         * @brief The draw call a command replays.
+         */
+        enum class Type : uint8_t {
+            Pixel,      ///< drawPixel, x and y are the pixel
+            Rectangle,  ///< drawRectangle, x, y, width, height and thickness describe the rectangle
+            Bitmap,     ///< drawBitmap, source is the Bitmap
+            Sprite,     ///< drawSprite, source is the Sprite
+            Text,       ///< drawText with a font, source is the IFont, x and y are the pen position and the baseline
+            DigitText   ///< drawText with a DigitSpriteSheet, source is the sheet, x and y are the pen position and the baseline
+        };
+
+        Type type; ///< The replayed draw call
+        DrawMode drawMode; ///< The drawing mode of the canvas when the call was recorded
+        Pixel color {0}; ///< The color of a pixel or a rectangle
+        ssize_t x {0}; ///< Horizontal position, see Type
+        ssize_t y {0}; ///< Vertical position, see Type
+        size_t width {0}; ///< Width of a rectangle
+        size_t height {0}; ///< Height of a rectangle
+        size_t thickness {0}; ///< Border thickness of a rectangle
+        const void* source {nullptr}; ///< The drawn object, see Type
+        uint64_t contentHash {0}; ///< Hash of the bitmap pixels, as a bitmap may change at the same address
+        size_t textOffset {0}; ///< Offset of the text in the display list text storage
+        size_t textLength {0}; ///< Length of the text in bytes
+        uint64_t hash {0}; ///< Hash of every field above and of the text, set by the display list
+        Rect bounds {}; ///< Pixels the command may write, clipped to the canvas
+    };
+
+    /**
+     * @class DisplayList
+     * @brief The draw calls of a frame, in the order they were made.
+     *
+     * Texts are copied into a storage owned by the list, so recorded commands do not depend on the memory
+     * of the frame. The storage is reused by the next frame: once it has grown, recording does not allocate.
+     */
+    class DisplayList {
+        std::vector<DrawCommand> commands_; ///< Recorded commands, in draw order
+        std::string text_; ///< Texts of the commands, one after the other
+        std::vector<std::pair<uint64_t, size_t>> index_; ///< (hash, command index) sorted by hash, for lookups
+
+    public:
+
+        /**
+         * @brief Removes every command, the memory is kept for the next frame.
+         */
+        void clear();
+
+        /**
+         * @brief Appends a command to the list.
+         * @param command The command to append, its text fields and hash are set by the list.
+         * @param text The text drawn by the command, if any.
+         */
+        void add(DrawCommand command, std::string_view text = {});
+
+        /**
+         * @brief Gets the recorded commands.
+         * @return The commands, in draw order.
+         */
+        [[nodiscard]]
+        inline const std::vector<DrawCommand>& getCommands() const;
+
+        /**
+         * @brief Gets the text of a command of the list.
+         * @param command A command of this list.
+         * @return The text drawn by the command, empty if it draws no text.
+         */
+        [[nodiscard]]
+        inline std::string_view getText(const DrawCommand& command) const;
+
+        /**
+         * @brief Collects the regions where two frames may differ.
+         * A command present in only one of the lists changes the pixels of its bounds.
+         * Commands are compared by value (type, mode, position, drawn object and text), not by position in the list,
+         * so the draw order of unchanged overlapping commands is assumed to be the same in both frames.
+         * @param previous The list of the previous frame.
+         * @param current The list of the new frame.
+         * @param regions The set receiving the bounds of the commands that changed.
+         */
+        static void diff(DisplayList& previous, DisplayList& current, RegionSet& regions);
+
+        /**
+         * @brief Computes the hash of the pixels of a bitmap, to detect a bitmap changed in place.
+         * @param pixels Pointer to the pixels.
+         * @param count The number of pixels.
+         * @return The 64-bit FNV-1a hash of the pixels.
+         */
+        [[nodiscard]]
+        static uint64_t hashPixels(const Pixel* pixels, size_t count);
+
+    private:
+
+        /**
+         * @brief Sorts the commands by hash, for contains().
+         */
+        void buildIndex();
+
+        /**
+         * @brief Checks if the list holds a command equal to the command of another list.
+         * buildIndex() must have been called since the last change of the list.
+         * @param other The list holding the command.
+         * @param command The command to search.
+         * @return True if an equal command was recorded in this list.
+         */
+        [[nodiscard]]
+        bool contains(const DisplayList& other, const DrawCommand& command) const;
+
+        /**
+         * @brief Checks if two commands draw the same thing.
+         * @param a The first command, from list listA.
+         * @param listA The list holding a.
+         * @param b The second command, from list listB.
+         * @param listB The list holding b.
+         * @return True if both commands write the same pixels.
+         */
+        [[nodiscard]]
+        static bool isSameCommand(const DrawCommand& a, const DisplayList& listA, const DrawCommand& b, const DisplayList& listB);
+
+        /**
+         * @brief Computes the hash of a command and of its text.
+         * @param command The command.
+         * @param text The text drawn by the command.
+         * @return The 64-bit FNV-1a hash.
+         */
+        [[nodiscard]]
+        static uint64_t hashCommand(const DrawCommand& command, std::string_view text);
+    };
+
+    // Inline methods implementation
+
+    inline const std::vector<DrawCommand>& DisplayList::getCommands() const {
+        return commands_;
+    }
+
+    inline std::string_view DisplayList::getText(const DrawCommand& command) const {
+        return std::string_view{text_}.substr(command.textOffset, command.textLength);
+    }
+
+} // namespace PiAlarm::gfx
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <cstdint> // For uint8_t
+
+namespace PiAlarm::gfx {
+
+    /**
+     * @enum DrawMode
+     * @brief Specifies how the pixels of a bitmap are written into a buffer.
+     *
+     * This enum defines different modes for drawing, such as normal drawing,
+     * ignoring black pixels, inverting colors, or both ignoring black pixels and inverting colors.
+     */
+    enum class DrawMode : uint8_t {
+        IgnoreBlack,        ///< Ignore black pixels when drawing
+        DisplayAll,         ///< Display all pixels without any filtering
+        Invert,             ///< Invert the pixel colors when drawing. Pixels that are 0 (black) after inversion will not be drawn.
+        InvertAndDisplayAll ///< Inverted drawing mode that displays all pixels
+    };
+
+} // namespace PiAlarm::gfx
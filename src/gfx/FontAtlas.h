@@ -0,0 +1,71 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+/**
+ * @namespace PiAlarm::gfx::atlas
+ * @brief Binary format of the pre-rendered font atlases.
+ *
+ * A font atlas holds the glyphs of one font face at one pixel size, rendered offline by the FontAtlasBaker tool.
+ * The file is made of a header, a table of glyph entries sorted by codepoint, then the 8-bit grayscale
+ * bitmaps of the glyphs, one after the other, row by row without padding.
+ * Every field is stored in the host byte order (little-endian on the supported targets).
+ */
+namespace PiAlarm::gfx::atlas {
+
+    constexpr std::array<char, 4> MAGIC {'P', 'A', 'F', 'A'}; ///< Identifies a PiAlarm font atlas file
+    constexpr uint32_t VERSION {1}; ///< Version of the format described here
+
+    /**
+     * @struct Header
+     * @brief Header at the start of a font atlas file.
+     */
+    struct Header {
+        std::array<char, 4> magic; ///< Must be equal to MAGIC
+        uint32_t version; ///< Must be equal to VERSION
+        int32_t pixelHeight; ///< The pixel size the glyphs were rendered at
+        int32_t ascender; ///< Ascender of the font in pixels
+        int32_t descender; ///< Descender of the font in pixels (negative)
+        int32_t lineHeight; ///< Line height of the font in pixels
+        uint32_t glyphCount; ///< Number of entries in the glyph table
+        uint32_t glyphTableOffset; ///< Offset in bytes of the glyph table from the start of the file
+        uint32_t bitmapDataOffset; ///< Offset in bytes of the bitmap data from the start of the file
+        uint32_t bitmapDataSize; ///< Size in bytes of the bitmap data
+    };
+
+    /**
+     * @struct GlyphEntry
+     * @brief Metrics and bitmap location of a glyph, in the glyph table.
+     */
+    struct GlyphEntry {
+        uint32_t codepoint; ///< Unicode codepoint of the glyph, the table is sorted on this field
+        int16_t bearingX; ///< The horizontal offset from the origin to the left side of the glyph
+        int16_t bearingY; ///< The vertical offset from the baseline to the top of the glyph
+        int16_t advance; ///< The horizontal advance to the next glyph
+        uint16_t width; ///< Width of the bitmap in pixels
+        uint16_t height; ///< Height of the bitmap in pixels
+        uint16_t reserved; ///< Padding, always 0
+        uint32_t bitmapOffset; ///< Offset in bytes of the bitmap from the start of the bitmap data
+    };
+
+    static_assert(std::is_trivially_copyable_v<Header> && sizeof(Header) == 40, "Unexpected atlas header layout");
+    static_assert(std::is_trivially_copyable_v<GlyphEntry> && sizeof(GlyphEntry) == 20, "Unexpected atlas glyph entry layout");
+
+    /**
+     * @brief Gets the path of the atlas baked from a font file at a given size.
+     * The atlas is next to the font file, e.g. "assets/fonts/Font-Light.ttf" at 48 pixels
+     * gives "assets/fonts/Font-Light-48.atlas".
+     * @param fontPath The path to the TrueType font file.
+     * @param pixelHeight The height of the font in pixels.
+     * @return The path of the atlas file.
+     */
+    inline std::string makeAtlasPath(const std::string& fontPath, int pixelHeight) {
+        const auto extension = fontPath.rfind('.');
+        const auto stem = (extension == std::string::npos) ? fontPath : fontPath.substr(0, extension);
+        return stem + "-" + std::to_string(pixelHeight) + ".atlas";
+    }
+
+} // namespace PiAlarm::gfx::atlas
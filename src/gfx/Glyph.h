@@ -33,19 +33,21 @@ namespace PiAlarm::gfx {
      * @struct PositionedGlyph
      * @brief Represents a glyph positioned at a specific horizontal offset.
      *
-     * This structure contains the rendered glyph data and its horizontal offset relative to the start of the text line.
+     * This structure references the rendered glyph data, typically owned by the glyph cache of a font,
+     * and holds its horizontal offset relative to the start of the text line.
+     * @note The referenced glyph must outlive the PositionedGlyph (see IFont::renderChar).
      */
     struct PositionedGlyph {
-        RenderedGlyph glyph; ///< The rendered glyph data
+        const RenderedGlyph& glyph; ///< The rendered glyph data, not owned
         ssize_t xOffset; ///< The horizontal offset relative to the start of the text line where the glyph is positioned
 
         /**
          * @brief Constructs a PositionedGlyph struct.
-         * @param glyph The rendered glyph data
+         * @param glyph The rendered glyph data, not copied
          * @param xOffset The horizontal offset relative to the start of the text line
          */
-        PositionedGlyph(RenderedGlyph glyph, ssize_t xOffset)
-            : glyph{std::move(glyph)}, xOffset{xOffset}
+        PositionedGlyph(const RenderedGlyph& glyph, ssize_t xOffset)
+            : glyph{glyph}, xOffset{xOffset}
         {}
     };
 
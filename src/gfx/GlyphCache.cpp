@@ -0,0 +1,32 @@
+#include <algorithm>
+
+#include "GlyphCache.h"
+
+namespace PiAlarm::gfx {
+
+    GlyphCache::GlyphCache(size_t capacity)
+        : capacity_{std::max<size_t>(capacity, 1)}
+    {
+        index_.reserve(capacity_);
+    }
+
+    void GlyphCache::clear() {
+        index_.clear();
+        entries_.clear();
+    }
+
+    const RenderedGlyph& GlyphCache::insert(UnicodeChar codepoint, RenderedGlyph glyph) {
+        if (entries_.size() >= capacity_) {
+            // evict the least recently used glyph
+            index_.erase(entries_.back().first);
+            entries_.pop_back();
+            ++stats_.evictions;
+        }
+
+        entries_.emplace_front(codepoint, std::move(glyph));
+        index_[codepoint] = entries_.begin();
+
+        return entries_.front().second;
+    }
+
+} // namespace PiAlarm::gfx
@@ -0,0 +1,132 @@
+#pragma once
+
+#include <cstddef>
+#include <list>
+#include <unordered_map>
+#include <utility>
+
+#include "Types.h"
+#include "Glyph.h"
+
+namespace PiAlarm::gfx {
+
+    /**
+     * @class GlyphCache
+     * @brief Bounded cache of rasterized glyphs for a single font face and pixel size.
+     *
+     * Glyphs are keyed by their Unicode codepoint and kept in least-recently-used order.
+     * When the cache is full, the least recently used glyph is evicted to make room for the new one.
+     * Cached glyphs are immutable and returned by reference, so a cache hit performs no rasterization and no copy.
+     *
+     * @note A reference returned by the cache stays valid until the glyph is evicted or the cache is cleared.
+     *       The capacity should therefore be larger than the number of distinct characters drawn in a single text.
+     * @note This class is not thread-safe, it is intended to be owned by a font used from the render thread.
+     */
+    class GlyphCache {
+    public:
+
+        /**
+         * @struct Stats
+         * @brief Counters describing the cache activity since its creation.
+         */
+        struct Stats {
+            size_t hits {0};      ///< Number of lookups served from the cache
+            size_t misses {0};    ///< Number of lookups that required a rasterization
+            size_t evictions {0}; ///< Number of glyphs removed to respect the capacity
+        };
+
+        static constexpr size_t DEFAULT_CAPACITY {128}; ///< Default maximum number of cached glyphs
+
+    private:
+        using Entry = std::pair<UnicodeChar, const RenderedGlyph>; ///< Cached glyph with its codepoint
+        using EntryList = std::list<Entry>; ///< Glyphs ordered from most to least recently used
+
+        size_t capacity_; ///< Maximum number of glyphs kept in the cache
+        EntryList entries_; ///< Cached glyphs, the front is the most recently used
+        std::unordered_map<UnicodeChar, EntryList::iterator> index_; ///< Codepoint lookup into the entries list
+        Stats stats_; ///< Activity counters
+
+    public:
+
+        /**
+         * @brief Constructs an empty glyph cache.
+         * @param capacity The maximum number of glyphs kept in the cache (at least 1).
+         */
+        explicit GlyphCache(size_t capacity = DEFAULT_CAPACITY);
+
+        /**
+         * @brief Gets a glyph from the cache, rasterizing it with the given function on a miss.
+         * @tparam RenderFunc Callable with the signature RenderedGlyph(UnicodeChar).
+         * @param codepoint The Unicode codepoint of the glyph.
+         * @param render The function used to rasterize the glyph if it is not cached yet.
+         * @return A reference to the cached, immutable glyph.
+         * @note If render throws, the cache is left unchanged (except for the miss counter).
+         */
+        template<typename RenderFunc>
+        const RenderedGlyph& getOrRender(UnicodeChar codepoint, RenderFunc&& render);
+
+        /**
+         * @brief Removes every glyph from the cache. The counters are kept.
+         */
+        void clear();
+
+        /**
+         * @brief Gets the activity counters of the cache.
+         * @return A reference to the cache statistics.
+         */
+        [[nodiscard]]
+        inline const Stats& getStats() const;
+
+        /**
+         * @brief Gets the number of glyphs currently cached.
+         * @return The number of cached glyphs.
+         */
+        [[nodiscard]]
+        inline size_t size() const;
+
+        /**
+         * @brief Gets the maximum number of glyphs the cache can hold.
+         * @return The capacity of the cache.
+         */
+        [[nodiscard]]
+        inline size_t capacity() const;
+
+    private:
+
+        /**
+         * @brief Inserts a freshly rasterized glyph, evicting the least recently used one if needed.
+         * @param codepoint The Unicode codepoint of the glyph.
+         * @param glyph The rasterized glyph.
+         * @return A reference to the cached glyph.
+         */
+        const RenderedGlyph& insert(UnicodeChar codepoint, RenderedGlyph glyph);
+    };
+
+    // Template & inline methods implementation
+
+    template<typename RenderFunc>
+    const RenderedGlyph& GlyphCache::getOrRender(UnicodeChar codepoint, RenderFunc&& render) {
+        auto it {index_.find(codepoint)};
+        if (it != index_.end()) {
+            ++stats_.hits;
+            entries_.splice(entries_.begin(), entries_, it->second); // mark as most recently used
+            return it->second->second;
+        }
+
+        ++stats_.misses;
+        return insert(codepoint, std::forward<RenderFunc>(render)(codepoint));
+    }
+
+    inline const GlyphCache::Stats& GlyphCache::getStats() const {
+        return stats_;
+    }
+
+    inline size_t GlyphCache::size() const {
+        return entries_.size();
+    }
+
+    inline size_t GlyphCache::capacity() const {
+        return capacity_;
+    }
+
+} // namespace PiAlarm::gfx
@@ -1,7 +1,12 @@
 #pragma once
 
 #include <cstddef> // For size_t
+#include <sys/types.h> // For ssize_t
 #include "Types.h"
+#include "Bitmap.h"
+#include "DrawMode.h"
+#include "Rect.h"
+#include "Sprite.h"
 
 namespace PiAlarm::gfx {
 
@@ -30,12 +35,49 @@ namespace PiAlarm::gfx {
          */
         virtual void setPixel(size_t x, size_t y, Pixel grayscale) = 0;
 
+        /**
+         * @brief Draws a bitmap into the buffer, row by row.
+         * The bitmap is clipped once against the clip region, then each visible row is written as a span.
+         * @param x The x-coordinate of the top-left corner of the bitmap, may be negative.
+         * @param y The y-coordinate of the top-left corner of the bitmap, may be negative.
+         * @param bitmap The bitmap to draw (8-bit grayscale).
+         * @param mode The drawing mode applied to each pixel of the bitmap.
+         */
+        virtual void blit(ssize_t x, ssize_t y, const Bitmap& bitmap, DrawMode mode) = 0;
+
+        /**
+         * @brief Draws a pre-packed sprite into the buffer, row by row.
+         * The sprite is clipped once against the clip region, transparent pixels keep the buffer content.
+         * @param x The x-coordinate of the top-left corner of the sprite, may be negative.
+         * @param y The y-coordinate of the top-left corner of the sprite, may be negative.
+         * @param sprite The sprite to draw (4-bit grayscale with an opacity mask).
+         */
+        virtual void blitSprite(ssize_t x, ssize_t y, const Sprite& sprite) = 0;
+
         /**
          * @brief Clears the buffer by setting all pixels to zero (black).
          * This method should be called to reset the buffer before drawing new content.
+         * @note The clip region does not apply, the whole buffer is cleared.
          */
         virtual void clear() = 0;
 
+        /**
+         * @brief Sets the pixels of a region to zero (black).
+         * @param region The region to clear, clipped to the buffer bounds.
+         */
+        virtual void clearRegion(const Rect& region) = 0;
+
+        /**
+         * @brief Restricts the following pixel writes (setPixel, blit, blitSprite) to a region.
+         * @param region The region where pixels can be written, clipped to the buffer bounds.
+         */
+        virtual void setClipRegion(const Rect& region) = 0;
+
+        /**
+         * @brief Removes the clip region, pixels can be written anywhere in the buffer again.
+         */
+        virtual void resetClipRegion() = 0;
+
         /**
          * @brief Gets the raw data of the buffer.
          * @return A pointer to the raw data of the buffer.
@@ -65,6 +107,26 @@ namespace PiAlarm::gfx {
          */
         [[nodiscard]]
         virtual size_t getHeight() const = 0;
+
+        /**
+         * @brief Gets the bounding box of the pixels that changed since the last flush.
+         * @return The region to send to the display, empty if the buffer content did not change.
+         * @note Implementations may widen the region to match their packed pixel layout.
+         */
+        [[nodiscard]]
+        virtual Rect getDirtyRegion() const = 0;
+
+        /**
+         * @brief Records the current buffer content as the content shown by the display.
+         * This method should be called once the dirty region has been sent to the display.
+         */
+        virtual void markFlushed() = 0;
+
+        /**
+         * @brief Marks the whole buffer as dirty, so the next flush sends the entire frame.
+         * This method should be called when the display content is unknown (e.g. after a display reset).
+         */
+        virtual void markAllDirty() = 0;
     };
 
 } // namespace PiAlarm::gfx
\ No newline at end of file
@@ -24,16 +24,20 @@ namespace PiAlarm::gfx {
         /**
          * @brief Renders a character and returns its bitmap representation.
          * @param utf8Char The character to render, represented as a UTF-8 encoded string.
-         * @return A GlyphBitmap containing the rendered character's bitmap data.
+         * @return A reference to the RenderedGlyph containing the rendered character's bitmap data.
+         * @note The returned glyph is owned by the font and stays valid while the font keeps it cached.
+         *       Implementations must keep at least every glyph of a line of text valid, so a text layout can reference them.
          */
-        virtual const RenderedGlyph renderChar(const UTF8Char& utf8Char) = 0;
+        virtual const RenderedGlyph& renderChar(const UTF8Char& utf8Char) = 0;
 
         /**
          * @brief Renders a character and returns its bitmap representation.
          * @param codepoint The Unicode codepoint of the character to render.
-         * @return A RenderedGlyph containing the rendered character's bitmap data.
+         * @return A reference to the RenderedGlyph containing the rendered character's bitmap data.
+         * @note The returned glyph is owned by the font and stays valid while the font keeps it cached.
+         *       Implementations must keep at least every glyph of a line of text valid, so a text layout can reference them.
          */
-        virtual const RenderedGlyph renderChar(UnicodeChar codepoint) = 0;
+        virtual const RenderedGlyph& renderChar(UnicodeChar codepoint) = 0;
 
         /**
          * @brief Gets the ascender of the font.
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cstddef> // For size_t
+
+namespace PiAlarm::gfx {
+
+    /**
+     * @struct Rect
+     * @brief Represents an axis-aligned rectangle in pixel coordinates.
+     *
+     * The origin is at the top-left corner of the buffer. A rectangle with a zero width or height is empty.
+     */
+    struct Rect {
+        size_t x {0};      ///< The x-coordinate of the top-left corner
+        size_t y {0};      ///< The y-coordinate of the top-left corner
+        size_t width {0};  ///< The width of the rectangle in pixels
+        size_t height {0}; ///< The height of the rectangle in pixels
+
+        /**
+         * @brief Checks if the rectangle covers no pixel.
+         * @return True if the width or the height is zero, false otherwise.
+         */
+        [[nodiscard]]
+        constexpr bool isEmpty() const {
+            return width == 0 || height == 0;
+        }
+
+        /**
+         * @brief Gets the area of the rectangle.
+         * @return The number of pixels covered by the rectangle.
+         */
+        [[nodiscard]]
+        constexpr size_t area() const {
+            return width * height;
+        }
+
+        constexpr bool operator==(const Rect&) const = default;
+    };
+
+} // namespace PiAlarm::gfx
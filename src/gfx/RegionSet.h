@@ -0,0 +1,149 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+
+#include "Rect.h"
+
+namespace PiAlarm::gfx {
+
+    /**
+     * @class RegionSet
+     * @brief Small, fixed-capacity set of rectangles covering the pixels to redraw.
+     *
+     * Overlapping rectangles are merged when added. When the set is full, the new rectangle is merged
+     * with the one whose bounding box grows the least, so the set always covers every added pixel,
+     * possibly with a few extra ones. It does not allocate.
+     */
+    class RegionSet {
+    public:
+        static constexpr size_t CAPACITY {4}; ///< Maximum number of distinct rectangles
+
+    private:
+        std::array<Rect, CAPACITY> regions_ {}; ///< The rectangles, the first count_ ones are used
+        size_t count_ {0}; ///< Number of rectangles in the set
+
+    public:
+
+        /**
+         * @brief Adds a rectangle to the set.
+         * @param region The rectangle to add, ignored if empty.
+         */
+        inline void add(const Rect& region);
+
+        /**
+         * @brief Removes every rectangle from the set.
+         */
+        inline void clear();
+
+        /**
+         * @brief Checks if the set covers no pixel.
+         * @return True if no rectangle was added since the last clear.
+         */
+        [[nodiscard]]
+        inline bool isEmpty() const;
+
+        /**
+         * @brief Gets the rectangles of the set.
+         * @return Pointer to the first rectangle, the set holds size() of them.
+         */
+        [[nodiscard]]
+        inline const Rect* begin() const;
+
+        /**
+         * @brief Gets the end of the rectangles of the set.
+         * @return Pointer past the last rectangle.
+         */
+        [[nodiscard]]
+        inline const Rect* end() const;
+
+        /**
+         * @brief Gets the number of rectangles in the set.
+         * @return The number of rectangles.
+         */
+        [[nodiscard]]
+        inline size_t size() const;
+
+        /**
+         * @brief Gets the smallest rectangle containing two rectangles.
+         * @param a The first rectangle, not empty.
+         * @param b The second rectangle, not empty.
+         * @return The bounding box of both rectangles.
+         */
+        [[nodiscard]]
+        static constexpr Rect unite(const Rect& a, const Rect& b);
+
+        /**
+         * @brief Checks if two rectangles share at least one pixel.
+         * @param a The first rectangle.
+         * @param b The second rectangle.
+         * @return True if the rectangles intersect.
+         */
+        [[nodiscard]]
+        static constexpr bool intersects(const Rect& a, const Rect& b);
+    };
+
+    // Inline methods implementation
+
+    inline void RegionSet::add(const Rect& region) {
+        if (region.isEmpty()) return;
+
+        Rect merged {region};
+
+        // absorb every rectangle overlapping the new one
+        for (size_t i {0}; i < count_;) {
+            if (intersects(regions_[i], merged)) {
+                merged = unite(regions_[i], merged);
+                regions_[i] = regions_[--count_];
+                i = 0; // the grown rectangle may now overlap one already checked
+            } else {
+                ++i;
+            }
+        }
+
+        if (count_ < CAPACITY) {
+            regions_[count_++] = merged;
+            return;
+        }
+
+        // full: merge with the rectangle whose bounding box grows the least
+        auto growth = [&merged](const Rect& r) { return unite(r, merged).area() - r.area(); };
+        auto best = std::ranges::min_element(regions_, {}, growth);
+        *best = unite(*best, merged);
+    }
+
+    inline void RegionSet::clear() {
+        count_ = 0;
+    }
+
+    inline bool RegionSet::isEmpty() const {
+        return count_ == 0;
+    }
+
+    inline const Rect* RegionSet::begin() const {
+        return regions_.data();
+    }
+
+    inline const Rect* RegionSet::end() const {
+        return regions_.data() + count_;
+    }
+
+    inline size_t RegionSet::size() const {
+        return count_;
+    }
+
+    constexpr Rect RegionSet::unite(const Rect& a, const Rect& b) {
+        const size_t left = std::min(a.x, b.x);
+        const size_t top = std::min(a.y, b.y);
+        const size_t right = std::max(a.x + a.width, b.x + b.width);
+        const size_t bottom = std::max(a.y + a.height, b.y + b.height);
+        return {left, top, right - left, bottom - top};
+    }
+
+    constexpr bool RegionSet::intersects(const Rect& a, const Rect& b) {
+        return a.x < b.x + b.width && b.x < a.x + a.width
+            && a.y < b.y + b.height && b.y < a.y + a.height;
+    }
+
+} // namespace PiAlarm::gfx
@@ -1,20 +1,269 @@
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
 #include "SDD1322Buffer.h"
 
 namespace PiAlarm::gfx {
 
-    void SDD1322Buffer::setPixel(size_t x, size_t y, Pixel grayscale) {
-        if (x>= BUFFER_PIXEL_WIDTH || y >= BUFFER_PIXEL_HEIGHT) return; // Out of bounds check
+    void SDD1322Buffer::blit(ssize_t x, ssize_t y, const Bitmap& bitmap, DrawMode mode) {
+        const auto clipLeft = static_cast<ssize_t>(clip_.x);
+        const auto clipTop = static_cast<ssize_t>(clip_.y);
+        const auto clipRight = static_cast<ssize_t>(clip_.x + clip_.width);
+        const auto clipBottom = static_cast<ssize_t>(clip_.y + clip_.height);
+
+        // Clip the bitmap against the clip region once
+        const ssize_t left = std::max(x, clipLeft);
+        const ssize_t top = std::max(y, clipTop);
+        const ssize_t right = std::min(x + static_cast<ssize_t>(bitmap.width), clipRight);
+        const ssize_t bottom = std::min(y + static_cast<ssize_t>(bitmap.height), clipBottom);
+
+        if (left >= right || top >= bottom) return; // fully outside
+
+        const Pixel* source = bitmap.pixels.data() + (top - y) * bitmap.width + (left - x);
+        const auto width = static_cast<size_t>(right - left);
+        const auto height = static_cast<size_t>(bottom - top);
+
+        switch (mode) {
+            case DrawMode::IgnoreBlack:
+                blitRows<DrawMode::IgnoreBlack>(left, top, source, bitmap.width, width, height);
+                break;
+            case DrawMode::DisplayAll:
+                blitRows<DrawMode::DisplayAll>(left, top, source, bitmap.width, width, height);
+                break;
+            case DrawMode::Invert:
+                blitRows<DrawMode::Invert>(left, top, source, bitmap.width, width, height);
+                break;
+            case DrawMode::InvertAndDisplayAll:
+                blitRows<DrawMode::InvertAndDisplayAll>(left, top, source, bitmap.width, width, height);
+                break;
+        }
+    }
+
+    void SDD1322Buffer::blitSprite(ssize_t x, ssize_t y, const Sprite& sprite) {
+        const auto clipLeft = static_cast<ssize_t>(clip_.x);
+        const auto clipTop = static_cast<ssize_t>(clip_.y);
+        const auto clipRight = static_cast<ssize_t>(clip_.x + clip_.width);
+        const auto clipBottom = static_cast<ssize_t>(clip_.y + clip_.height);
+
+        // Clip the sprite against the clip region once
+        const ssize_t left = std::max(x, clipLeft);
+        const ssize_t top = std::max(y, clipTop);
+        const ssize_t right = std::min(x + static_cast<ssize_t>(sprite.width), clipRight);
+        const ssize_t bottom = std::min(y + static_cast<ssize_t>(sprite.height), clipBottom);
+
+        if (left >= right || top >= bottom) return; // fully outside
+
+        const size_t rowBytes = sprite.getRowBytes();
+        const auto firstCol = static_cast<size_t>(left - x); // first visible column of the sprite
+        const auto width = static_cast<size_t>(right - left);
+
+        for (ssize_t row {top}; row < bottom; ++row) {
+            const PixelPairByte* pixels = sprite.pixels + (row - y) * rowBytes;
+            const PixelPairByte* mask = sprite.mask + (row - y) * rowBytes;
+            PixelPairByte* target = buffer_.data() + row * ROW_BYTES + left / 2;
+            size_t col {firstCol};
+            size_t remaining {width};
+
+            // Odd start column in the buffer, the first pixel goes in the low nibble
+            if (left % 2 != 0) {
+                if (getNibble(mask, col)) {
+                    *target = (*target & 0b1111'0000) | getNibble(pixels, col);
+                }
+                ++target;
+                ++col;
+                --remaining;
+            }
+
+            // Whole pixel pairs: the sprite bytes are used as is when aligned, shifted by a nibble otherwise
+            if (col % 2 == 0) {
+                const size_t bytes = remaining / 2;
+                mergeMaskedBytes(target, pixels + col / 2, mask + col / 2, bytes);
+                target += bytes;
+                col += 2 * bytes;
+                remaining -= 2 * bytes;
+            } else {
+                for (; remaining >= 2; remaining -= 2, col += 2, ++target) {
+                    const PixelPairByte m = (mask[col / 2] << 4) | (mask[col / 2 + 1] >> 4);
+                    const PixelPairByte v = (pixels[col / 2] << 4) | (pixels[col / 2 + 1] >> 4);
+                    *target = (*target & ~m) | (v & m);
+                }
+            }
+
+            // Remaining pixel, in the high nibble
+            if (remaining != 0 && getNibble(mask, col)) {
+                *target = (*target & 0b0000'1111) | (getNibble(pixels, col) << 4);
+            }
+        }
+    }
+
+    void SDD1322Buffer::mergeMaskedBytes(PixelPairByte* target, const PixelPairByte* source, const PixelPairByte* mask, size_t count) {
+        size_t i {0};
+
+        // a word at a time, then half a word, then byte by byte
+        for (; i + sizeof(Word) <= count; i += sizeof(Word)) {
+            Word value, opaque, current;
+            std::memcpy(&value, source + i, sizeof(Word));
+            std::memcpy(&opaque, mask + i, sizeof(Word));
+            std::memcpy(&current, target + i, sizeof(Word));
+            current = (current & ~opaque) | (value & opaque);
+            std::memcpy(target + i, &current, sizeof(Word));
+        }
 
-        auto gray = get4BitGrayscale(grayscale);
-        size_t byteIndex = y * (BUFFER_PIXEL_WIDTH/2) + (x/2);
+        if (i + sizeof(uint32_t) <= count) {
+            uint32_t value, opaque, current;
+            std::memcpy(&value, source + i, sizeof(uint32_t));
+            std::memcpy(&opaque, mask + i, sizeof(uint32_t));
+            std::memcpy(&current, target + i, sizeof(uint32_t));
+            current = (current & ~opaque) | (value & opaque);
+            std::memcpy(target + i, &current, sizeof(uint32_t));
+            i += sizeof(uint32_t);
+        }
 
-        if (x % 2 == 0) {
-            // Even column, set the high nibble
-            buffer_.at(byteIndex) = (buffer_[byteIndex] & 0b0000'1111) | (gray << 4);
-        } else {
-            // Odd column, set the low nibble
-            buffer_.at(byteIndex) = (buffer_[byteIndex] & 0b1111'0000) | gray;
+        for (; i < count; ++i) {
+            target[i] = (target[i] & ~mask[i]) | (source[i] & mask[i]);
         }
     }
 
+    template<DrawMode Mode>
+    void SDD1322Buffer::blitRows(size_t x, size_t y, const Pixel* source, size_t stride, size_t width, size_t height) {
+        for (size_t row {0}; row < height; ++row, source += stride) {
+            PixelPairByte* target = buffer_.data() + (y + row) * ROW_BYTES + x / 2;
+            size_t col {0};
+
+            // Odd start column, the first pixel goes in the low nibble
+            if (x % 2 != 0) {
+                if (isDrawn<Mode>(source[0])) {
+                    *target = (*target & 0b1111'0000) | toGrayscale<Mode>(source[0]);
+                }
+                ++target;
+                ++col;
+            }
+
+            // Blocks of 8 pixels, packed at once into 4 bytes
+            if constexpr (std::endian::native == std::endian::little) {
+                for (; col + 8 <= width; col += 8, target += 4) {
+                    packEightPixels<Mode>(source + col, target);
+                }
+            }
+
+            // Remaining pixel pairs, one byte per iteration
+            for (; col + 1 < width; col += 2, ++target) {
+                const Pixel high = source[col];
+                const Pixel low = source[col + 1];
+                const PixelPairByte value = (toGrayscale<Mode>(high) << 4) | toGrayscale<Mode>(low);
+                const PixelPairByte mask = (-PixelPairByte{isDrawn<Mode>(high)} & 0b1111'0000) | (-PixelPairByte{isDrawn<Mode>(low)} & 0b0000'1111);
+                *target = (*target & ~mask) | (value & mask);
+            }
+
+            // Remaining pixel, in the high nibble
+            if (col < width && isDrawn<Mode>(source[col])) {
+                *target = (*target & 0b0000'1111) | (toGrayscale<Mode>(source[col]) << 4);
+            }
+        }
+    }
+
+    template<DrawMode Mode>
+    void SDD1322Buffer::packEightPixels(const Pixel* source, PixelPairByte* target) {
+        constexpr Word LOW_BITS {0x7F7F'7F7F'7F7F'7F7F};
+        constexpr Word HIGH_NIBBLES {0xF0F0'F0F0'F0F0'F0F0};
+        constexpr Word EVEN_HIGH_NIBBLES {0x00F0'00F0'00F0'00F0}; // high nibble of pixels 0, 2, 4, 6
+        constexpr Word ODD_HIGH_NIBBLES {0x000F'000F'000F'000F}; // high nibble of pixels 1, 3, 5, 7, once shifted
+
+        Word pixels;
+        std::memcpy(&pixels, source, sizeof(Word));
+
+        if constexpr (Mode == DrawMode::Invert || Mode == DrawMode::InvertAndDisplayAll) {
+            pixels = ~pixels; // 255 - value on each byte
+        }
+
+        // Each pixel is 0xFF if written, 0x00 if skipped (IgnoreBlack skips 0, Invert skips 255 i.e. 0 once inverted)
+        Word drawn {~Word{0}};
+        if constexpr (Mode == DrawMode::IgnoreBlack || Mode == DrawMode::Invert) {
+            const Word nonZero = (((pixels & LOW_BITS) + LOW_BITS) | pixels) & ~LOW_BITS; // top bit of non-zero bytes
+            drawn = (nonZero >> 7) * 0xFF;
+        }
+
+        // Keep the 4-bit grayscale of each pixel and move the odd pixels next to the even ones:
+        // each 16-bit lane then holds one packed pixel pair in its low byte
+        auto pack = [](Word nibbles) {
+            Word pairs = (nibbles & EVEN_HIGH_NIBBLES) | ((nibbles >> 12) & ODD_HIGH_NIBBLES);
+            pairs = (pairs | (pairs >> 8)) & 0x0000'FFFF'0000'FFFF;
+            return static_cast<uint32_t>(pairs | (pairs >> 16));
+        };
+
+        const uint32_t value = pack(pixels & HIGH_NIBBLES);
+        const uint32_t mask = pack(drawn & HIGH_NIBBLES);
+
+        uint32_t current;
+        std::memcpy(&current, target, sizeof(current));
+        current = (current & ~mask) | (value & mask);
+        std::memcpy(target, &current, sizeof(current));
+    }
+
+    void SDD1322Buffer::clearRegion(const Rect& region) {
+        const size_t left = std::min(region.x, BUFFER_PIXEL_WIDTH);
+        const size_t top = std::min(region.y, BUFFER_PIXEL_HEIGHT);
+        const size_t right = std::min(region.x + region.width, BUFFER_PIXEL_WIDTH);
+        const size_t bottom = std::min(region.y + region.height, BUFFER_PIXEL_HEIGHT);
+
+        if (left >= right || top >= bottom) return;
+
+        // whole bytes between the possibly odd edges
+        const size_t firstByte = (left + 1) / 2;
+        const size_t endByte = right / 2;
+
+        for (size_t y {top}; y < bottom; ++y) {
+            PixelPairByte* row = buffer_.data() + y * ROW_BYTES;
+
+            if (left % 2 != 0) {
+                row[left / 2] &= 0b1111'0000; // odd left edge, low nibble only
+            }
+            if (endByte > firstByte) {
+                std::memset(row + firstByte, 0, endByte - firstByte);
+            }
+            if (right % 2 != 0 && right / 2 >= firstByte) {
+                row[right / 2] &= 0b0000'1111; // odd right edge, high nibble only
+            }
+        }
+    }
+
+    Rect SDD1322Buffer::getDirtyRegion() const {
+        if (!frontValid_) {
+            return {0, 0, BUFFER_PIXEL_WIDTH, BUFFER_PIXEL_HEIGHT};
+        }
+
+        size_t top {BUFFER_PIXEL_HEIGHT}, bottom {0};
+        size_t left {ROW_BYTES}, right {0};
+
+        for (size_t y {0}; y < BUFFER_PIXEL_HEIGHT; ++y) {
+            const PixelPairByte* back = buffer_.data() + y * ROW_BYTES;
+            const PixelPairByte* front = front_.data() + y * ROW_BYTES;
+
+            // compare the row one word at a time, from the left
+            size_t firstWord {0};
+            while (firstWord < ROW_WORDS && wordDiff(back, front, firstWord) == 0) ++firstWord;
+
+            if (firstWord == ROW_WORDS) continue; // unchanged row
+
+            // then from the right, the scan stops at firstWord at the latest
+            size_t lastWord {ROW_WORDS - 1};
+            while (lastWord > firstWord && wordDiff(back, front, lastWord) == 0) --lastWord;
+
+            top = std::min(top, y);
+            bottom = y;
+            left = std::min(left, firstWord * sizeof(Word) + firstDifferingByte(wordDiff(back, front, firstWord)));
+            right = std::max(right, lastWord * sizeof(Word) + lastDifferingByte(wordDiff(back, front, lastWord)));
+        }
+
+        if (top > bottom) return {}; // nothing changed
+
+        return {left * 2, top, (right - left + 1) * 2, bottom - top + 1};
+    }
+
+    void SDD1322Buffer::markFlushed() {
+        front_ = buffer_;
+        frontValid_ = true;
+    }
+
 } // namespace PiAlarm::gfx
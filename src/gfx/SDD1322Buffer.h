@@ -1,6 +1,9 @@
 #pragma once
 
+#include <algorithm>
 #include <array>
+#include <bit>
+#include <cstring>
 
 #include "IBuffer.h"
 
@@ -12,8 +15,16 @@ namespace PiAlarm::gfx {
      *
      * This class implements the IBuffer interface and provides methods to manage
      * a framebuffer for the SSD1322 OLED display, which has a resolution of 256x64 pixels.
+     *
+     * The buffer is double-buffered: drawing happens in the back frame, while the front frame keeps
+     * the content that was last flushed to the display. Comparing both frames (word by word) gives the region
+     * that changed since the last flush, so only that region is sent, and nothing at all when the new frame
+     * is identical to the displayed one.
+     *
+     * The class is final, so calls made through an SDD1322Buffer (e.g. by BasicCanvas<SDD1322Buffer>)
+     * are not virtual and the pixel access can be inlined.
      */
-    class SDD1322Buffer : public IBuffer {
+    class SDD1322Buffer final : public IBuffer {
     public:
         static constexpr size_t BUFFER_PIXEL_WIDTH {256}; ///< Width of the buffer in pixels
         static constexpr size_t BUFFER_PIXEL_HEIGHT {64}; ///< Height of the buffer in pixels
@@ -21,8 +32,18 @@ namespace PiAlarm::gfx {
     private:
         using PixelPairByte = uint8_t; ///< Type alias for a byte representing 2 pixels (4 bits per pixel)
         using PixelGrayscale = uint8_t; ///< Type alias for a pixel grayscale value (0-15)
+        using FrameData = std::array<PixelPairByte, BUFFER_PIXEL_WIDTH * BUFFER_PIXEL_HEIGHT / 2>; ///< Type alias for a packed frame
+
+        using Word = uint64_t; ///< Type alias for the unit used to compare the frames
 
-        std::array<PixelPairByte, BUFFER_PIXEL_WIDTH * BUFFER_PIXEL_HEIGHT / 2> buffer_; ///< Buffer to hold pixel data (4 bits per pixel)
+        static constexpr size_t ROW_BYTES {BUFFER_PIXEL_WIDTH / 2}; ///< Number of bytes in a row of pixels
+        static constexpr size_t ROW_WORDS {ROW_BYTES / sizeof(Word)}; ///< Number of comparison words in a row of pixels
+        static_assert(ROW_BYTES % sizeof(Word) == 0, "A row must contain a whole number of comparison words");
+
+        FrameData buffer_ {}; ///< Back frame, holds the pixel data being drawn (4 bits per pixel)
+        FrameData front_ {}; ///< Front frame, copy of the back frame as it was at the last flush
+        bool frontValid_ {false}; ///< Whether front_ matches the display content (false until the first flush)
+        Rect clip_ {0, 0, BUFFER_PIXEL_WIDTH, BUFFER_PIXEL_HEIGHT}; ///< Region where pixels can be written
 
     public:
 
@@ -38,7 +59,28 @@ namespace PiAlarm::gfx {
          * @param y The y-coordinate of the pixel (vertical position).
          * @param grayscale The grayscale value to set for the pixel (0-255).
          */
-        void setPixel(size_t x, size_t y, Pixel grayscale) override;
+        inline void setPixel(size_t x, size_t y, Pixel grayscale) override;
+
+        /**
+         * @brief Draws a bitmap into the buffer, row by row.
+         * The bitmap is clipped once against the clip region, then each visible row is packed directly into the 4-bit pixel pairs
+         * by an inner loop specialised for the drawing mode, 8 pixels (4 bytes) per iteration.
+         * @param x The x-coordinate of the top-left corner of the bitmap, may be negative.
+         * @param y The y-coordinate of the top-left corner of the bitmap, may be negative.
+         * @param bitmap The bitmap to draw (8-bit grayscale).
+         * @param mode The drawing mode applied to each pixel of the bitmap.
+         */
+        void blit(ssize_t x, ssize_t y, const Bitmap& bitmap, DrawMode mode) override;
+
+        /**
+         * @brief Draws a pre-packed sprite into the buffer, row by row.
+         * The sprite already has the nibble layout of the buffer: when its pixels land on the same nibble parity,
+         * each byte is merged at once through the mask, otherwise the bytes are realigned by 4 bits first.
+         * @param x The x-coordinate of the top-left corner of the sprite, may be negative.
+         * @param y The y-coordinate of the top-left corner of the sprite, may be negative.
+         * @param sprite The sprite to draw (4-bit grayscale with an opacity mask).
+         */
+        void blitSprite(ssize_t x, ssize_t y, const Sprite& sprite) override;
 
         /**
          * @brief Clears the buffer by setting all pixels to zero (black).
@@ -46,6 +88,23 @@ namespace PiAlarm::gfx {
          */
         void clear() override;
 
+        /**
+         * @brief Sets the pixels of a region to zero (black).
+         * @param region The region to clear, clipped to the buffer bounds.
+         */
+        void clearRegion(const Rect& region) override;
+
+        /**
+         * @brief Restricts the following pixel writes to a region.
+         * @param region The region where pixels can be written, clipped to the buffer bounds.
+         */
+        inline void setClipRegion(const Rect& region) override;
+
+        /**
+         * @brief Removes the clip region.
+         */
+        inline void resetClipRegion() override;
+
         /**
          * @brief Gets the raw data of the buffer.
          * @return A pointer to the raw data of the buffer.
@@ -77,6 +136,26 @@ namespace PiAlarm::gfx {
         [[nodiscard]]
         constexpr size_t getHeight() const override;
 
+        /**
+         * @brief Gets the bounding box of the bytes that changed since the last flush.
+         * The region is computed by comparing the back frame with the front (last flushed) frame, 8 bytes at a time,
+         * so pixels that were cleared and redrawn with the same value are not reported.
+         * @return The changed region, aligned on byte boundaries (2 pixels), or the whole buffer
+         *         if no frame has been flushed yet. Empty if nothing changed.
+         */
+        [[nodiscard]]
+        Rect getDirtyRegion() const override;
+
+        /**
+         * @brief Records the current back frame as the front (last flushed) frame.
+         */
+        void markFlushed() override;
+
+        /**
+         * @brief Forgets the last flushed frame, so the next dirty region covers the whole buffer.
+         */
+        inline void markAllDirty() override;
+
     private:
 
         /**
@@ -85,14 +164,133 @@ namespace PiAlarm::gfx {
          * @return The corresponding 4-bit grayscale pixel value (0-15).
          */
         inline static PixelGrayscale get4BitGrayscale(Pixel _8BitGrayScale);
+
+        /**
+         * @brief Writes the clipped rows of a bitmap with the given drawing mode.
+         * @tparam Mode The drawing mode, fixed at compile time so the inner loop has no mode switch.
+         * @param x The x-coordinate of the first written pixel in the buffer.
+         * @param y The y-coordinate of the first written row in the buffer.
+         * @param source Pointer to the first visible pixel of the bitmap.
+         * @param stride The number of pixels between two rows of the bitmap.
+         * @param width The number of pixels written per row.
+         * @param height The number of rows written.
+         */
+        template<DrawMode Mode>
+        void blitRows(size_t x, size_t y, const Pixel* source, size_t stride, size_t width, size_t height);
+
+        /**
+         * @brief Merges packed pixel pairs into the buffer through an opacity mask, 8 bytes per iteration.
+         * @param target Pointer to the first byte of the buffer to write.
+         * @param source Pointer to the packed pixel pairs.
+         * @param mask Pointer to the packed mask, 0xF on the nibbles to write.
+         * @param count The number of bytes to merge.
+         */
+        static void mergeMaskedBytes(PixelPairByte* target, const PixelPairByte* source, const PixelPairByte* mask, size_t count);
+
+        /**
+         * @brief Gets a pixel nibble from a packed row.
+         * @param row Pointer to the first byte of the packed row.
+         * @param col The column of the pixel in the row.
+         * @return The 4-bit value of the pixel, in the low nibble.
+         */
+        inline static PixelGrayscale getNibble(const PixelPairByte* row, size_t col);
+
+        /**
+         * @brief Packs 8 source pixels into 4 bytes of the buffer with the given drawing mode.
+         * The pixels are processed together in a 64-bit word, skipped pixels keep the nibble already in the buffer.
+         * @tparam Mode The drawing mode.
+         * @param source Pointer to the 8 source pixels.
+         * @param target Pointer to the 4 bytes of the buffer, the first source pixel goes in a high nibble.
+         * @note The bit layout assumes a little-endian host.
+         */
+        template<DrawMode Mode>
+        static void packEightPixels(const Pixel* source, PixelPairByte* target);
+
+        /**
+         * @brief Checks if a source pixel is written with the given drawing mode.
+         * @tparam Mode The drawing mode.
+         * @param value The 8-bit source pixel.
+         * @return False if the pixel is transparent in this mode.
+         */
+        template<DrawMode Mode>
+        static constexpr bool isDrawn(Pixel value);
+
+        /**
+         * @brief Converts a source pixel to the 4-bit grayscale written with the given drawing mode.
+         * @tparam Mode The drawing mode.
+         * @param value The 8-bit source pixel.
+         * @return The 4-bit grayscale value (0-15).
+         */
+        template<DrawMode Mode>
+        static constexpr PixelGrayscale toGrayscale(Pixel value);
+
+        /**
+         * @brief Compares a word of a row in two frames.
+         * @param back Pointer to the first byte of the row in the back frame.
+         * @param front Pointer to the first byte of the row in the front frame.
+         * @param wordIndex Index of the word in the row.
+         * @return The XOR of both words, zero if they are identical.
+         */
+        inline static Word wordDiff(const PixelPairByte* back, const PixelPairByte* front, size_t wordIndex);
+
+        /**
+         * @brief Gets the offset of the first (lowest address) differing byte in a word.
+         * @param diff The XOR of the two compared words, must not be zero.
+         * @return The offset of the byte in the word.
+         */
+        inline static size_t firstDifferingByte(Word diff);
+
+        /**
+         * @brief Gets the offset of the last (highest address) differing byte in a word.
+         * @param diff The XOR of the two compared words, must not be zero.
+         * @return The offset of the byte in the word.
+         */
+        inline static size_t lastDifferingByte(Word diff);
     };
 
     // Inline method implementations
 
+    inline void SDD1322Buffer::setPixel(size_t x, size_t y, Pixel grayscale) {
+        // Out of clip region check, the unsigned subtraction also rejects coordinates before the region
+        if (x - clip_.x >= clip_.width || y - clip_.y >= clip_.height) return;
+
+        auto gray = get4BitGrayscale(grayscale);
+        size_t byteIndex = y * ROW_BYTES + (x/2);
+
+        if (x % 2 == 0) {
+            // Even column, set the high nibble
+            buffer_[byteIndex] = (buffer_[byteIndex] & 0b0000'1111) | (gray << 4);
+        } else {
+            // Odd column, set the low nibble
+            buffer_[byteIndex] = (buffer_[byteIndex] & 0b1111'0000) | gray;
+        }
+    }
+
+    inline SDD1322Buffer::PixelGrayscale SDD1322Buffer::getNibble(const PixelPairByte* row, size_t col) {
+        return (col % 2 == 0) ? (row[col / 2] >> 4) : (row[col / 2] & 0b0000'1111);
+    }
+
     inline void SDD1322Buffer::clear() {
         buffer_.fill(0x00);
     }
 
+    inline void SDD1322Buffer::setClipRegion(const Rect& region) {
+        const size_t right = std::min(region.x + region.width, BUFFER_PIXEL_WIDTH);
+        const size_t bottom = std::min(region.y + region.height, BUFFER_PIXEL_HEIGHT);
+        clip_.x = std::min(region.x, BUFFER_PIXEL_WIDTH);
+        clip_.y = std::min(region.y, BUFFER_PIXEL_HEIGHT);
+        clip_.width = right > clip_.x ? right - clip_.x : 0;
+        clip_.height = bottom > clip_.y ? bottom - clip_.y : 0;
+    }
+
+    inline void SDD1322Buffer::resetClipRegion() {
+        clip_ = {0, 0, BUFFER_PIXEL_WIDTH, BUFFER_PIXEL_HEIGHT};
+    }
+
+    inline void SDD1322Buffer::markAllDirty() {
+        frontValid_ = false;
+    }
+
     constexpr const uint8_t* SDD1322Buffer::data() const {
         return buffer_.data();
     }
@@ -113,4 +311,48 @@ namespace PiAlarm::gfx {
         return _8BitGrayScale / 16; // Convert 8-bit grayscale to 4-bit grayscale (0-15)
     }
 
+    template<DrawMode Mode>
+    constexpr bool SDD1322Buffer::isDrawn(Pixel value) {
+        if constexpr (Mode == DrawMode::IgnoreBlack) {
+            return value != 0;
+        } else if constexpr (Mode == DrawMode::Invert) {
+            return value != 255; // will become black
+        } else {
+            return true;
+        }
+    }
+
+    template<DrawMode Mode>
+    constexpr SDD1322Buffer::PixelGrayscale SDD1322Buffer::toGrayscale(Pixel value) {
+        if constexpr (Mode == DrawMode::Invert || Mode == DrawMode::InvertAndDisplayAll) {
+            return get4BitGrayscale(255 - value);
+        } else {
+            return get4BitGrayscale(value);
+        }
+    }
+
+    inline SDD1322Buffer::Word SDD1322Buffer::wordDiff(const PixelPairByte* back, const PixelPairByte* front, size_t wordIndex) {
+        Word backWord, frontWord;
+        // memcpy has no alignment requirement and compiles to plain loads
+        std::memcpy(&backWord, back + wordIndex * sizeof(Word), sizeof(Word));
+        std::memcpy(&frontWord, front + wordIndex * sizeof(Word), sizeof(Word));
+        return backWord ^ frontWord;
+    }
+
+    inline size_t SDD1322Buffer::firstDifferingByte(Word diff) {
+        if constexpr (std::endian::native == std::endian::little) {
+            return std::countr_zero(diff) / 8;
+        } else {
+            return std::countl_zero(diff) / 8;
+        }
+    }
+
+    inline size_t SDD1322Buffer::lastDifferingByte(Word diff) {
+        if constexpr (std::endian::native == std::endian::little) {
+            return sizeof(Word) - 1 - std::countl_zero(diff) / 8;
+        } else {
+            return sizeof(Word) - 1 - std::countr_zero(diff) / 8;
+        }
+    }
+
 } // namespace PiAlarm::gfx
\ No newline at end of file
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace PiAlarm::gfx {
+
+    /**
+     * @struct Sprite
+     * @brief Represents an image already converted to the 4-bit packed pixel layout of the display.
+     *
+     * Sprites are generated at build time from the PNG files of assets/pictograms (see the PictogramConverter tool)
+     * and embedded as constexpr data, so drawing one needs no decoding and no per-pixel conversion.
+     * Each row holds 2 pixels per byte, the even column in the high nibble; a row is padded to a whole byte.
+     * The mask has the same layout, with a nibble set to 0xF for each opaque pixel and 0x0 for each transparent one.
+     */
+    struct Sprite {
+        size_t width; ///< The width of the sprite in pixels
+        size_t height; ///< The height of the sprite in pixels
+        const uint8_t* pixels; ///< The packed 4-bit grayscale pixels, row after row
+        const uint8_t* mask; ///< The packed opacity mask, same layout as the pixels
+
+        /**
+         * @brief Gets the number of bytes in a row of the sprite.
+         * @return The number of bytes between two rows of pixels (or of the mask).
+         */
+        [[nodiscard]]
+        constexpr size_t getRowBytes() const;
+
+        /**
+         * @brief Gets the width of the sprite.
+         * @return The width of the sprite in pixels.
+         */
+        [[nodiscard]]
+        constexpr size_t getWidth() const;
+
+        /**
+         * @brief Gets the height of the sprite.
+         * @return The height of the sprite in pixels.
+         */
+        [[nodiscard]]
+        constexpr size_t getHeight() const;
+    };
+
+    constexpr size_t Sprite::getRowBytes() const {
+        return (width + 1) / 2;
+    }
+
+    constexpr size_t Sprite::getWidth() const {
+        return width;
+    }
+
+    constexpr size_t Sprite::getHeight() const {
+        return height;
+    }
+
+} // namespace PiAlarm::gfx
@@ -1,4 +1,5 @@
 #include <stdexcept>
+#include <algorithm>
 #include "utf8.h"
 
 #include "TrueTypeFont.h"
@@ -8,7 +9,9 @@ namespace PiAlarm::gfx {
     FT_Library TrueTypeFont::ftLibrary = nullptr;
     std::once_flag TrueTypeFont::ftInitFlag;
 
-    TrueTypeFont::TrueTypeFont(const std::string& fontPath, int pixelHeight) {
+    TrueTypeFont::TrueTypeFont(const std::string& fontPath, int pixelHeight, size_t glyphCacheCapacity)
+        : glyphCache_{glyphCacheCapacity}
+    {
 
         std::call_once(ftInitFlag, []() {
             if (FT_Init_FreeType(&ftLibrary)) {
@@ -32,7 +35,7 @@ namespace PiAlarm::gfx {
         }
     }
 
-    const RenderedGlyph TrueTypeFont::renderChar(const UTF8Char& utf8Char) {
+    const RenderedGlyph& TrueTypeFont::renderChar(const UTF8Char& utf8Char) {
         auto it = utf8Char.begin();
         auto end = utf8Char.end();
         uint32_t codepoint = utf8::next(it, end); // Decode first char
@@ -40,7 +43,13 @@ namespace PiAlarm::gfx {
         return renderChar(codepoint);
     }
 
-    const RenderedGlyph TrueTypeFont::renderChar(UnicodeChar codepoint) {
+    const RenderedGlyph& TrueTypeFont::renderChar(UnicodeChar codepoint) {
+        return glyphCache_.getOrRender(codepoint, [this](UnicodeChar c) {
+            return rasterizeChar(c);
+        });
+    }
+
+    RenderedGlyph TrueTypeFont::rasterizeChar(UnicodeChar codepoint) const {
 
         if (FT_Load_Char(face, codepoint, FT_LOAD_RENDER)) {
             throw std::runtime_error("Error when loading character. Codepoint = " + std::to_string(codepoint));
@@ -56,11 +65,9 @@ namespace PiAlarm::gfx {
             Bitmap{bmp.width, bmp.rows}
         };
 
-        // copy FT_Bitmap pixels to glyph bitmap
+        // copy FT_Bitmap rows to glyph bitmap (the FreeType pitch may be larger than the width)
         for (size_t y = 0; y < bmp.rows; ++y) {
-            for (size_t x = 0; x < bmp.width; ++x) {
-                glyph.bitmap.pixels[y * bmp.width + x] = bmp.buffer[y * bmp.pitch + x];
-            }
+            std::copy_n(bmp.buffer + y * bmp.pitch, bmp.width, glyph.bitmap.pixels.begin() + y * bmp.width);
         }
 
         return glyph;
@@ -6,6 +6,7 @@
 #include <mutex>
 
 #include "IFont.h"
+#include "GlyphCache.h"
 
 namespace PiAlarm::gfx {
 
@@ -15,12 +16,15 @@ namespace PiAlarm::gfx {
      *
      * This class uses FreeType to load and render TrueType fonts, providing methods
      * to render characters and retrieve font metrics such as ascender, descender, and line height.
+     * Rendered glyphs are kept in a bounded GlyphCache, so FreeType only rasterizes a character
+     * the first time it is drawn.
      */
     class TrueTypeFont : public IFont {
         static FT_Library ftLibrary; ///< FreeType library instance, initialized once
         static std::once_flag ftInitFlag; ///< Flag to ensure FreeType is initialized only once
 
         FT_Face face; ///< FreeType face object representing the loaded font
+        GlyphCache glyphCache_; ///< Cache of the glyphs already rasterized with this face and pixel size
 
     public:
 
@@ -29,9 +33,11 @@ namespace PiAlarm::gfx {
          * Initializes the FreeType library and loads the font from the specified path.
          * @param fontPath The path to the TrueType font file.
          * @param pixelHeight The height of the font in pixels.
+         * @param glyphCacheCapacity The maximum number of rasterized glyphs kept in cache,
+         *                           it must be larger than the number of distinct characters in a line of text.
          * @throws std::runtime_error if the font cannot be loaded or initialized.
          */
-        TrueTypeFont(const std::string& fontPath, int pixelHeight);
+        TrueTypeFont(const std::string& fontPath, int pixelHeight, size_t glyphCacheCapacity = GlyphCache::DEFAULT_CAPACITY);
 
         /**
          * @brief Default destructor for TrueTypeFont.
@@ -43,18 +49,18 @@ namespace PiAlarm::gfx {
         /**
          * @brief Renders a character and returns its bitmap representation.
          * @param utf8Char The character to render, represented as a UTF-8 encoded string.
-         * @return A RenderedGlyph containing the rendered character's bitmap data.
+         * @return A reference to the cached RenderedGlyph containing the rendered character's bitmap data.
          * @throws std::runtime_error if the character cannot be loaded or rendered.
          */
-        const RenderedGlyph renderChar(const UTF8Char& utf8Char) override;
+        const RenderedGlyph& renderChar(const UTF8Char& utf8Char) override;
 
         /**
          * @brief Renders a character and returns its bitmap representation.
          * @param codepoint The Unicode codepoint of the character to render.
-         * @return A RenderedGlyph containing the rendered character's bitmap data.
+         * @return A reference to the cached RenderedGlyph containing the rendered character's bitmap data.
          * @throws std::runtime_error if the character cannot be loaded or rendered.
          */
-        const RenderedGlyph renderChar(UnicodeChar codepoint) override;
+        const RenderedGlyph& renderChar(UnicodeChar codepoint) override;
 
         [[nodiscard]]
         inline int getAscender() const override;
@@ -62,6 +68,24 @@ namespace PiAlarm::gfx {
         inline int getDescender() const override;
         [[nodiscard]]
         inline int getLineHeight() const override;
+
+        /**
+         * @brief Gets the hit, miss and eviction counters of the glyph cache.
+         * A steady-state frame should only increase the hit counter.
+         * @return A reference to the glyph cache statistics.
+         */
+        [[nodiscard]]
+        inline const GlyphCache::Stats& getGlyphCacheStats() const;
+
+    private:
+
+        /**
+         * @brief Rasterizes a character with FreeType.
+         * @param codepoint The Unicode codepoint of the character to render.
+         * @return A RenderedGlyph containing the rendered character's bitmap data.
+         * @throws std::runtime_error if the character cannot be loaded or rendered.
+         */
+        RenderedGlyph rasterizeChar(UnicodeChar codepoint) const;
     };
 
     // inline methods implementation
@@ -88,4 +112,8 @@ namespace PiAlarm::gfx {
         return 0;
     }
 
+    inline const GlyphCache::Stats& TrueTypeFont::getGlyphCacheStats() const {
+        return glyphCache_.getStats();
+    }
+
 } // namespace PiAlarm::gfx
\ No newline at end of file
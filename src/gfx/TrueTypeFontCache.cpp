@@ -1,5 +1,11 @@
+#include <filesystem>
+
 #include "TrueTypeFontCache.h"
 #include "TrueTypeFont.h"
+#ifdef FONT_ATLAS
+#include "AtlasFont.h"
+#include "FontAtlas.h"
+#endif
 
 namespace PiAlarm::gfx {
 
@@ -18,13 +24,25 @@ namespace PiAlarm::gfx {
             return it->second;
         }
 
-        // not found in cache, create a new TrueTypeFont
-        auto font {std::make_shared<TrueTypeFont>(fontPath, pixelHeight)};
+        // not found in cache, create a new font
+        auto font {createFont(fontPath, pixelHeight)};
         cache_[key] = font;
 
         return font;
     }
 
+    std::shared_ptr<IFont> TrueTypeFontCache::createFont(const std::string& fontPath, int pixelHeight) {
+#ifdef FONT_ATLAS
+        // prefer the atlas baked at build time, it needs neither FreeType nor rasterization
+        const auto atlasPath {atlas::makeAtlasPath(fontPath, pixelHeight)};
+        if (std::filesystem::exists(atlasPath)) {
+            return std::make_shared<AtlasFont>(atlasPath);
+        }
+#endif
+
+        return std::make_shared<TrueTypeFont>(fontPath, pixelHeight);
+    }
+
     std::string TrueTypeFontCache::makeKey(const std::string& fontPath, int pixelHeight) {
         return fontPath + ":" + std::to_string(pixelHeight);
     }
@@ -21,6 +21,8 @@ namespace PiAlarm::gfx {
      *
      * This class provides a static method to retrieve a TrueType font from the cache,
      * creating it if it does not already exist. It uses a mutex to ensure thread safety.
+     * When a font atlas was baked for the requested font and size, the font is served from the atlas
+     * instead of being rasterized with FreeType.
      */
     class TrueTypeFontCache {
         static std::unordered_map<std::string, std::shared_ptr<IFont>> cache_; ///< Cache for TrueType fonts, mapping font paths and pixel heights to font objects
@@ -38,12 +40,21 @@ namespace PiAlarm::gfx {
          * @brief Retrieves a TrueType font from the cache or creates it if not found.
          * @param fontPath The path to the TrueType font file.
          * @param pixelHeight The height of the font in pixels.
-         * @return A shared pointer to the TrueTypeFont object.
+         * @return A shared pointer to the font object.
          */
         static std::shared_ptr<IFont> getFont(const std::string& fontPath, int pixelHeight);
 
     private:
 
+        /**
+         * @brief Creates a font, from its baked atlas if available, otherwise from the TrueType file.
+         * @param fontPath The path to the TrueType font file.
+         * @param pixelHeight The height of the font in pixels.
+         * @return A shared pointer to the new font object.
+         * @throws std::runtime_error if the font cannot be loaded.
+         */
+        static std::shared_ptr<IFont> createFont(const std::string& fontPath, int pixelHeight);
+
         /**
          * @brief Generates a unique key for the font based on its path and pixel height.
          * This key is used to store and retrieve the font from the cache.
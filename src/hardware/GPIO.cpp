@@ -8,6 +8,32 @@
 
 namespace PiAlarm::hardware {
 
+    namespace {
+
+        /**
+         * @brief Converts the timestamp of a line event to the steady clock.
+         * Since Linux 5.7, events are stamped with CLOCK_MONOTONIC, which is the clock of std::chrono::steady_clock.
+         * Older kernels use CLOCK_REALTIME: such a timestamp is in the future of the monotonic clock,
+         * it is converted with its age on the wall clock.
+         * @param ts The timestamp of the event.
+         * @return The time of the event on the steady clock.
+         */
+        std::chrono::steady_clock::time_point toSteadyTime(const timespec& ts) {
+            using namespace std::chrono;
+
+            const auto stamp = duration_cast<steady_clock::duration>(seconds{ts.tv_sec} + nanoseconds{ts.tv_nsec});
+            const auto steadyNow = steady_clock::now();
+
+            if (stamp <= steadyNow.time_since_epoch()) {
+                return steady_clock::time_point{stamp};
+            }
+
+            const auto age = system_clock::now().time_since_epoch() - stamp;
+            return steadyNow - duration_cast<steady_clock::duration>(age);
+        }
+
+    } // namespace
+
     GPIO::GPIO(const std::string &chipName, unsigned int lineNumber) {
         chip_ = gpiod_chip_open_by_name(chipName.c_str());
         if (!chip_) {
@@ -114,11 +140,21 @@ namespace PiAlarm::hardware {
             throw std::runtime_error("Error reading GPIO event: " + std::string(std::strerror(errno)));
         }
 
-        GPIOEvent result;
-        result.type = (ev.event_type == GPIOD_LINE_EVENT_RISING_EDGE) ? GPIOEvent::Type::RisingEdge : GPIOEvent::Type::FallingEdge;
+        return convertEvent(ev);
+    }
 
-        result.timestamp = std::chrono::steady_clock::now();
+    int GPIO::getEventFd() const {
+        int fd = gpiod_line_event_get_fd(line_);
+        if (fd < 0) {
+            throw std::runtime_error("Unable to get GPIO event file descriptor : " + std::string(std::strerror(errno)));
+        }
+        return fd;
+    }
 
+    GPIOEvent GPIO::convertEvent(const gpiod_line_event& event) {
+        GPIOEvent result;
+        result.type = (event.event_type == GPIOD_LINE_EVENT_RISING_EDGE) ? GPIOEvent::Type::RisingEdge : GPIOEvent::Type::FallingEdge;
+        result.timestamp = toSteadyTime(event.ts);
         return result;
     }
 
@@ -38,7 +38,7 @@ namespace PiAlarm::hardware {
         };
 
         Type type; ///< The type of edge detected (rising or falling)
-        std::chrono::steady_clock::time_point timestamp; ///< The timestamp when the event occurred
+        std::chrono::steady_clock::time_point timestamp; ///< The time the kernel detected the edge
     };
 
     /**
@@ -226,6 +226,24 @@ namespace PiAlarm::hardware {
          */
         [[nodiscard]]
         GPIOEvent readEvent() const;
+
+        /**
+         * @brief Gets the file descriptor signaling the events of the GPIO line.
+         * It becomes readable when an event is waiting, so it can be watched with poll or epoll.
+         * @return The file descriptor, owned by the line.
+         * @throws std::runtime_error if the line is not set for edge detection.
+         */
+        [[nodiscard]]
+        int getEventFd() const;
+
+        /**
+         * @brief Converts an event read from libgpiod.
+         * The event keeps the time the kernel detected the edge, not the time it was read.
+         * @param event The event read from a line.
+         * @return The event, with its timestamp on the steady clock.
+         */
+        [[nodiscard]]
+        static GPIOEvent convertEvent(const gpiod_line_event& event);
     };
 
     // Inline methods implementations
@@ -0,0 +1,120 @@
+#ifdef RASPBERRY_PI
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+#include "GPIOLines.h"
+
+namespace PiAlarm::hardware {
+
+    GPIOLines::GPIOLines(const std::vector<GPIOConfig>& configs) {
+        if (configs.empty() || configs.size() > GPIOD_LINE_BULK_MAX_LINES) {
+            throw std::invalid_argument("Invalid number of GPIO lines: " + std::to_string(configs.size()));
+        }
+
+        const std::string& chipName = configs.front().chipName;
+        std::vector<unsigned int> offsets;
+        offsets.reserve(configs.size());
+
+        for (const auto& config : configs) {
+            if (config.chipName != chipName) {
+                throw std::invalid_argument("GPIO lines requested together must be on the same chip: " + chipName + " and " + config.chipName);
+            }
+            offsets.push_back(config.lineNumber);
+        }
+
+        chip_ = gpiod_chip_open_by_name(chipName.c_str());
+        if (!chip_) {
+            throw std::runtime_error("Unable to open GPIO chip: " + chipName + " : " + std::strerror(errno));
+        }
+
+        if (gpiod_chip_get_lines(chip_, offsets.data(), static_cast<unsigned int>(offsets.size()), &bulk_) < 0) {
+            gpiod_chip_close(chip_);
+            throw std::runtime_error("Unable to get GPIO lines from chip: " + chipName + " : " + std::strerror(errno));
+        }
+    }
+
+    GPIOLines::~GPIOLines() {
+        if (requested_) gpiod_line_release_bulk(&bulk_);
+        if (chip_) gpiod_chip_close(chip_);
+    }
+
+    void GPIOLines::requestBothEdgesEvents() {
+        if (requested_) {
+            gpiod_line_release_bulk(&bulk_);
+            requested_ = false;
+        }
+
+        if (gpiod_line_request_bulk_both_edges_events(&bulk_, GPIO::CONSUMER) < 0) {
+            throw std::runtime_error("Unable to set GPIO edge detection on the lines : " + std::string(std::strerror(errno)));
+        }
+        requested_ = true;
+    }
+
+    std::vector<int> GPIOLines::getEventFds() const {
+        if (!requested_) {
+            throw std::runtime_error("GPIO lines are not requested, no event file descriptor.");
+        }
+
+        std::vector<int> fds;
+        fds.reserve(bulk_.num_lines);
+
+        for (unsigned int i {0}; i < bulk_.num_lines; ++i) {
+            int fd = gpiod_line_event_get_fd(bulk_.lines[i]);
+            if (fd < 0) {
+                throw std::runtime_error("Unable to get GPIO event file descriptor : " + std::string(std::strerror(errno)));
+            }
+            fds.push_back(fd);
+        }
+        return fds;
+    }
+
+    void GPIOLines::readEvents(std::vector<GPIOLineEvent>& events) {
+        if (!requested_) {
+            throw std::runtime_error("GPIO lines are not requested, cannot read events.");
+        }
+
+        // One wait for every line, 0 for non-blocking
+        timespec timeout {};
+        gpiod_line_bulk readyLines {};
+
+        const int ret = gpiod_line_event_wait_bulk(&bulk_, &timeout, &readyLines);
+        if (ret < 0) {
+            throw std::runtime_error("Error waiting for GPIO events: " + std::string(std::strerror(errno)));
+        }
+        if (ret == 0) return; // no event
+
+        const size_t firstEvent = events.size();
+        std::array<gpiod_line_event, EVENT_READ_BATCH> buffer {};
+
+        for (unsigned int i {0}; i < readyLines.num_lines; ++i) {
+            gpiod_line* line = readyLines.lines[i];
+
+            const int count = gpiod_line_event_read_multiple(line, buffer.data(), EVENT_READ_BATCH);
+            if (count < 0) {
+                throw std::runtime_error("Error reading GPIO events: " + std::string(std::strerror(errno)));
+            }
+
+            const size_t index = indexOf(line);
+            for (int j {0}; j < count; ++j) {
+                events.push_back({index, GPIO::convertEvent(buffer[j])});
+            }
+        }
+
+        // The lines are read one after the other, restore the order the edges happened in
+        std::stable_sort(events.begin() + static_cast<std::ptrdiff_t>(firstEvent), events.end(),
+            [](const GPIOLineEvent& a, const GPIOLineEvent& b) { return a.event.timestamp < b.event.timestamp; });
+    }
+
+    size_t GPIOLines::indexOf(const gpiod_line* line) const {
+        const auto end = bulk_.lines + bulk_.num_lines;
+        return static_cast<size_t>(std::find(bulk_.lines, end, line) - bulk_.lines);
+    }
+
+} // namespace PiAlarm::hardware
+
+#endif // RASPBERRY_PI
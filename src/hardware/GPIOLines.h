@@ -0,0 +1,107 @@
+#pragma once
+
+#ifdef RASPBERRY_PI
+
+#include <gpiod.h>
+#include <cstddef>
+#include <vector>
+
+#include "GPIO.h"
+
+namespace PiAlarm::hardware {
+
+    /**
+     * @struct GPIOLineEvent
+     * @brief An event on one of the lines of a GPIOLines.
+     */
+    struct GPIOLineEvent {
+        size_t lineIndex; ///< Index of the line, in the order the lines were given
+        GPIOEvent event; ///< The edge and the time the kernel detected it
+    };
+
+    /**
+     * @class GPIOLines
+     * @brief A group of input lines of the same GPIO chip, requested and read together.
+     *
+     * The lines are requested for edge events in a single bulk request, and the waiting events of every line
+     * are found with a single wait. Each event keeps the time the kernel detected the edge,
+     * so it does not depend on how late it is read.
+     */
+    class GPIOLines {
+        static constexpr unsigned int EVENT_READ_BATCH {16}; ///< Maximum number of events read from a line at once
+
+        gpiod_chip* chip_; ///< Pointer to the GPIO chip of the lines
+        gpiod_line_bulk bulk_ {}; ///< The lines, in the order they were given
+        bool requested_ {false}; ///< Whether the lines are requested
+
+    public:
+
+        /**
+         * @brief Opens the lines of the given configurations.
+         * @param configs The configuration of each line, all on the same chip.
+         * @throws std::invalid_argument if there is no line, too many lines or the lines are on different chips.
+         * @throws std::runtime_error if the chip or a line cannot be opened.
+         */
+        explicit GPIOLines(const std::vector<GPIOConfig>& configs);
+
+        /**
+         * @brief Releases the lines and closes the chip.
+         */
+        ~GPIOLines();
+
+        GPIOLines(const GPIOLines&) = delete; ///< No copy constructor
+        GPIOLines& operator=(const GPIOLines&) = delete; ///< No copy assignment operator
+        GPIOLines(GPIOLines&&) = delete; ///< No move constructor
+        GPIOLines& operator=(GPIOLines&&) = delete; ///< No move assignment operator
+
+        /**
+         * @brief Requests every line as an input detecting both edges, in a single request.
+         * @throws std::runtime_error if the lines cannot be requested.
+         */
+        void requestBothEdgesEvents();
+
+        /**
+         * @brief Gets the number of lines.
+         * @return The number of lines of the group.
+         */
+        [[nodiscard]]
+        inline size_t size() const;
+
+        /**
+         * @brief Gets the file descriptors signaling the events of the lines.
+         * The kernel gives one per line: they can be watched together with poll or epoll.
+         * @return The event file descriptor of each line, in the order of the lines.
+         * @throws std::runtime_error if the lines are not requested.
+         */
+        [[nodiscard]]
+        std::vector<int> getEventFds() const;
+
+        /**
+         * @brief Reads the events waiting on the lines, without blocking.
+         * The events are sorted by time, the events of a line are read at most EVENT_READ_BATCH at a time:
+         * the remaining ones are read by the next call.
+         * @param events The list the events are appended to.
+         * @throws std::runtime_error if the lines are not requested or the events cannot be read.
+         */
+        void readEvents(std::vector<GPIOLineEvent>& events);
+
+    private:
+
+        /**
+         * @brief Gets the index of a line of the group.
+         * @param line A line of the group.
+         * @return The index of the line, in the order the lines were given.
+         */
+        [[nodiscard]]
+        size_t indexOf(const gpiod_line* line) const;
+    };
+
+    // Inline methods implementation
+
+    inline size_t GPIOLines::size() const {
+        return bulk_.num_lines;
+    }
+
+} // namespace PiAlarm::hardware
+
+#endif // RASPBERRY_PI
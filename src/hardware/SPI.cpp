@@ -5,14 +5,17 @@
 #include <stdexcept>
 #include <linux/spi/spidev.h>
 #include <sys/ioctl.h>
+#include <array>
 #include <cstring>
 #include <cerrno>
+#include <fstream>
 
 #include "SPI.h"
 
 namespace PiAlarm::hardware {
 
     SPI::SPI(uint32_t chipSelect, uint32_t speed)
+        : speed_{speed}, maxMessageSize_{readMaxMessageSize()}
     {
         const std::string device = "/dev/spidev0." + std::to_string(chipSelect);
 
@@ -62,18 +65,64 @@ namespace PiAlarm::hardware {
     }
 
     void SPI::writeData(const uint8_t* data, size_t length) {
-        size_t totalWritten = 0;
+        const Transfer transfer {data, length};
+        writeBatch({&transfer, 1});
+    }
+
+    void SPI::writeBatch(std::span<const Transfer> transfers) {
+        std::array<spi_ioc_transfer, MAX_TRANSFERS_PER_MESSAGE> message;
+        size_t count {0};
+        size_t messageSize {0};
 
-        while (totalWritten < length) {
-            const size_t chunkSize = std::min(MAX_DATA_SIZE, length - totalWritten);
-            const ssize_t bytesWritten = write(fd_, data + totalWritten, chunkSize);
+        auto sendMessage = [&] {
+            if (count == 0) return;
 
-            if (bytesWritten != static_cast<ssize_t>(chunkSize)) {
-                throw std::runtime_error("SPI write failed: " + std::string(std::strerror(errno)));
+            // SPI_IOC_MESSAGE(count) with a count only known at runtime
+            const auto request = _IOC(_IOC_WRITE, SPI_IOC_MAGIC, 0, count * sizeof(spi_ioc_transfer));
+            if (ioctl(fd_, request, message.data()) < 0) {
+                throw std::runtime_error("SPI transfer failed: " + std::string(std::strerror(errno)));
             }
 
-            totalWritten += bytesWritten;
+            ++messageCount_;
+            bytesWritten_ += messageSize;
+            count = 0;
+            messageSize = 0;
+        };
+
+        for (const auto& transfer : transfers) {
+            size_t offset {0};
+
+            while (offset < transfer.length) {
+                if (count == message.size() || messageSize == maxMessageSize_) {
+                    sendMessage(); // the message is full
+                }
+
+                const size_t length = std::min(transfer.length - offset, maxMessageSize_ - messageSize);
+
+                // the chip select stays active between the transfers of a message (cs_change is 0)
+                message[count] = spi_ioc_transfer{};
+                message[count].tx_buf = reinterpret_cast<uintptr_t>(transfer.data + offset);
+                message[count].len = static_cast<uint32_t>(length);
+                message[count].speed_hz = speed_;
+                message[count].bits_per_word = 8;
+                ++count;
+
+                offset += length;
+                messageSize += length;
+            }
+        }
+
+        sendMessage();
+    }
+
+    size_t SPI::readMaxMessageSize() {
+        std::ifstream parameter {BUFSIZ_PARAMETER_PATH};
+        size_t size {0};
+
+        if (!(parameter >> size) || size == 0) {
+            return DEFAULT_MAX_MESSAGE_SIZE;
         }
+        return size;
     }
 
 } // namespace PiAlarm::hardware
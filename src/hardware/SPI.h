@@ -2,6 +2,8 @@
 
 #ifdef RASPBERRY_PI
 
+#include <cstdint>
+#include <span>
 #include <string>
 
 namespace PiAlarm::hardware {
@@ -32,12 +34,35 @@ namespace PiAlarm::hardware {
      * SPI (Serial Peripheral Interface) is a synchronous serial communication protocol
      * used for short-distance communication, primarily in embedded systems.
      *
+     * Data is sent with SPI_IOC_MESSAGE ioctls, each carrying an array of transfers. The spidev driver
+     * refuses messages larger than its `bufsiz` module parameter (4096 bytes by default), so a batch
+     * is split into as few messages as this limit allows. Raising it (e.g. `spidev.bufsiz=65536` on the kernel
+     * command line) lets a whole SSD1322 frame go out in a single ioctl.
+     *
      * Made with the help of ChatGPT.
      */
     class SPI {
+    public:
+
+        /**
+         * @struct Transfer
+         * @brief A span of bytes to send, part of a batch.
+         */
+        struct Transfer {
+            const uint8_t* data; ///< Pointer to the bytes to send
+            size_t length; ///< Number of bytes to send
+        };
+
+    private:
         int fd_ {-1}; ///< File descriptor for the SPI device
+        uint32_t speed_; ///< SPI communication speed in Hz
+        size_t maxMessageSize_; ///< Maximum number of bytes in one SPI_IOC_MESSAGE, the spidev bufsiz
+        size_t messageCount_ {0}; ///< Number of SPI_IOC_MESSAGE ioctls made
+        size_t bytesWritten_ {0}; ///< Number of bytes sent
 
-        static constexpr size_t MAX_DATA_SIZE {4096}; ///< Maximum data size for SPI transfer
+        static constexpr size_t MAX_TRANSFERS_PER_MESSAGE {64}; ///< Maximum number of transfers in one SPI_IOC_MESSAGE
+        static constexpr size_t DEFAULT_MAX_MESSAGE_SIZE {4096}; ///< The spidev bufsiz default, used if it cannot be read
+        static constexpr const char* BUFSIZ_PARAMETER_PATH {"/sys/module/spidev/parameters/bufsiz"}; ///< Where spidev exposes bufsiz
 
     public:
 
@@ -80,8 +105,71 @@ namespace PiAlarm::hardware {
          * @throws std::runtime_error if the write operation fails.
          */
         void writeData(const uint8_t* data, size_t length);
+
+        /**
+         * Writes several spans of bytes to the SPI device, one after the other, without releasing the chip select.
+         * The transfers are packed into as few SPI_IOC_MESSAGE ioctls as the spidev bufsiz allows,
+         * a transfer larger than it being split across messages.
+         * @param transfers The spans of bytes to write, in order.
+         * @throws std::runtime_error if an ioctl fails.
+         */
+        void writeBatch(std::span<const Transfer> transfers);
+
+        /**
+         * @brief Gets the SPI communication speed.
+         * @return The speed in Hz.
+         */
+        [[nodiscard]]
+        inline uint32_t getSpeed() const;
+
+        /**
+         * @brief Gets the maximum number of bytes sent by a single ioctl, the spidev bufsiz.
+         * @return The maximum message size in bytes.
+         */
+        [[nodiscard]]
+        inline size_t getMaxMessageSize() const;
+
+        /**
+         * @brief Gets the number of SPI_IOC_MESSAGE ioctls made since the device was opened.
+         * @return The number of ioctls.
+         */
+        [[nodiscard]]
+        inline size_t getMessageCount() const;
+
+        /**
+         * @brief Gets the number of bytes sent since the device was opened.
+         * @return The number of bytes.
+         */
+        [[nodiscard]]
+        inline size_t getBytesWritten() const;
+
+    private:
+
+        /**
+         * @brief Reads the spidev bufsiz module parameter.
+         * @return The maximum message size in bytes, or DEFAULT_MAX_MESSAGE_SIZE if it cannot be read.
+         */
+        static size_t readMaxMessageSize();
     };
 
+    // Inline methods implementation
+
+    inline uint32_t SPI::getSpeed() const {
+        return speed_;
+    }
+
+    inline size_t SPI::getMaxMessageSize() const {
+        return maxMessageSize_;
+    }
+
+    inline size_t SPI::getMessageCount() const {
+        return messageCount_;
+    }
+
+    inline size_t SPI::getBytesWritten() const {
+        return bytesWritten_;
+    }
+
 } // namespace PiAlarm::hardware
 
 #endif // RASPBERRY_PI
\ No newline at end of file
@@ -3,6 +3,7 @@
 #include <thread>
 #include <chrono>
 #include <cassert>
+#include <algorithm>
 
 #include "SSD1322.h"
 
@@ -17,52 +18,120 @@ namespace PiAlarm::hardware {
     {}
 
     void SSD1322::reset() {
+        ramWriteReady_ = false; // the controller state is lost
         resetPin_.set(GPIO::LOW);
         std::this_thread::sleep_for(std::chrono::milliseconds(20));
         resetPin_.set(GPIO::HIGH);
         std::this_thread::sleep_for(std::chrono::milliseconds(20));
     }
 
-    void SSD1322::setDCPinCommand() {
-        dcPin_.set(GPIO::LOW);
-    }
-
-    void SSD1322::setDCPinData() {
-        dcPin_.set(GPIO::HIGH);
-    }
-
     void SSD1322::sendCommand(CommandByte cmd) {
+        ramWriteReady_ = false;
         setDCPinCommand();
         spi_.writeByte(cmd);
     }
 
     void SSD1322::sendData(DataByte data) {
+        ramWriteReady_ = false; // an argument, or a pixel moving the RAM address pointer
         setDCPinData();
         spi_.writeByte(data);
     }
 
     void SSD1322::sendData(const DataByte* data, size_t length) {
+        ramWriteReady_ = false;
         setDCPinData();
         spi_.writeData(data, length);
     }
 
-    void SSD1322::flush(const uint8_t* buffer, size_t size) {
-        assert(size == DISPLAY_HEIGHT * (DISPLAY_WIDTH/2)); // Ensure the buffer size matches the expected dimensions
+    void SSD1322::send(const CommandSequence& sequence) {
+        ramWriteReady_ = false;
 
-        // Set the drawing area to the full display size
-        sendCommand(SETCOLUMN);
-        sendData(COLUMN_START); // Start column
-        sendData(COLUMN_END); // End column (256 pixels / 4 bits per pixel = 64 columns)
+        for (size_t i {0}; i < sequence.getRunCount(); ++i) {
+            const auto run = sequence.getRun(i);
 
-        sendCommand(SETROW);
-        sendData(ROW_START); // Start row
-        sendData(ROW_END); // End row (63)
+            setDCPin(run.isData ? GPIO::HIGH : GPIO::LOW);
+            spi_.writeData(run.bytes, run.length);
+        }
+    }
 
-        // Enable graphic data write mode
-        sendCommand(ENWRITEDATA);
+    void SSD1322::sendPixels(const DataByte* data, size_t length) {
+        setDCPinData();
+        spi_.writeData(data, length);
+    }
 
-        // Send the framebuffer data
-        sendData(buffer, size);
+    void SSD1322::flush(const uint8_t* buffer, size_t size) {
+        flushRegion(buffer, size, 0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT);
+    }
+
+    void SSD1322::flushRegion(const uint8_t* buffer, size_t size, size_t x, size_t y, size_t width, size_t height) {
+        assert(size == DISPLAY_HEIGHT * ROW_BYTES); // Ensure the buffer size matches the expected dimensions
+
+        // Clip the region to the display
+        if (x >= DISPLAY_WIDTH || y >= DISPLAY_HEIGHT) return;
+        width = std::min(width, DISPLAY_WIDTH - x);
+        height = std::min(height, DISPLAY_HEIGHT - y);
+        if (width == 0 || height == 0) return;
+
+        const auto start = std::chrono::steady_clock::now();
+        const size_t messageCountBefore = spi_.getMessageCount();
+        const size_t bytesWrittenBefore = spi_.getBytesWritten();
+
+        // Widen the horizontal bounds to whole SSD1322 columns (4 pixels each)
+        const size_t firstColumn = x / PIXELS_PER_COLUMN;
+        const size_t lastColumn = (x + width - 1) / PIXELS_PER_COLUMN;
+        const size_t lastRow = y + height - 1;
+
+        const std::array<DataByte, 4> window {
+            static_cast<DataByte>(COLUMN_START + firstColumn), // Start column
+            static_cast<DataByte>(COLUMN_START + lastColumn), // End column
+            static_cast<DataByte>(ROW_START + y), // Start row
+            static_cast<DataByte>(ROW_START + lastRow) // End row
+        };
+
+        // After a complete write of the window, the RAM address pointer is back at its start and the
+        // controller stays in write mode until the next command: the same window can be written again directly
+        if (!ramWriteReady_ || window != window_) {
+            // Restrict the drawing area to the region, then enable graphic data write mode
+            CommandSequence sequence;
+            sequence.command(SETCOLUMN, {window[0], window[1]})
+                    .command(SETROW, {window[2], window[3]})
+                    .command(ENWRITEDATA);
+            send(sequence);
+
+            window_ = window;
+        }
+        ramWriteReady_ = false; // until the whole window is written
+
+        const size_t firstByte = firstColumn * PIXELS_PER_COLUMN / 2;
+        const size_t regionRowBytes = (lastColumn - firstColumn + 1) * PIXELS_PER_COLUMN / 2;
+
+        if (regionRowBytes == ROW_BYTES) {
+            // Full-width rows are contiguous in the framebuffer
+            sendPixels(buffer + y * ROW_BYTES, height * ROW_BYTES);
+        } else {
+            // Gather the region rows so they are sent in a single transfer
+            for (size_t row {0}; row < height; ++row) {
+                std::copy_n(buffer + (y + row) * ROW_BYTES + firstByte, regionRowBytes, regionBuffer_.begin() + row * regionRowBytes);
+            }
+            sendPixels(regionBuffer_.data(), height * regionRowBytes);
+        }
+        ramWriteReady_ = true;
+
+        recordFlush(start, messageCountBefore, bytesWrittenBefore);
+    }
+
+    void SSD1322::recordFlush(std::chrono::steady_clock::time_point start, size_t messageCountBefore, size_t bytesWrittenBefore) {
+        const auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+        const size_t bytes = spi_.getBytesWritten() - bytesWrittenBefore;
+
+        flushTiming_.flushes++;
+        flushTiming_.bytes += bytes;
+        flushTiming_.messages += spi_.getMessageCount() - messageCountBefore;
+        flushTiming_.last = duration;
+        flushTiming_.max = std::max(flushTiming_.max, duration);
+        flushTiming_.total += duration;
+        // 8 clock cycles per byte
+        flushTiming_.lineTime += std::chrono::nanoseconds{bytes * 8 * 1'000'000'000ULL / spi_.getSpeed()};
     }
 
     void SSD1322::initialize() {
@@ -70,73 +139,41 @@ namespace PiAlarm::hardware {
         // DC pin is used to switch between command and data mode
         // Reset pin is used to reset the display
         dcPin_.setOutput(GPIO::LOW);
+        dcLevel_ = GPIO::LOW;
         resetPin_.setOutput(GPIO::HIGH);
 
         reset();
 
         // commands documentation: https://www.crystalfontz.com/controllers/datasheet-viewer.php?id=427 (chapter 9 & 10)
-        sendCommand(CMDLOCK);                       // 0xFD - Command Lock
-        sendData(0x12);                             // Unlock OLED driver IC
-
-        sendCommand(DISPLAYOFF);                    // 0xAE - Display OFF
-
-        sendCommand(DISPLAYCLK);                    // 0xB3 - Set Display Clock Divide Ratio/Oscillator Frequency
-        sendData(0x91);                             // Divide by 2, ~80 FPS
-
-        sendCommand(SETMULTIPLEX);                  // 0xCA - Set Multiplex Ratio
-        sendData(0x3F);                             // 1/64
-
-        sendCommand(SETDISPLAYOFFSET);              // 0xA2 - Set Display Offset
-        sendData(0x00);                             // No offset
-
-        sendCommand(SETSTARTLINE);                  // 0xA1 - Set Display Start Line
-        sendData(0x00);                             // Line 0
-
-        sendCommand(SEGREMAP);                      // 0xA0 - Set Remap and Dual COM Mode
-        sendData(0x14);                             // Horizontal increment, nibble remap
-        sendData(0x11);                             // Dual COM mode
-
-        sendCommand(SETGPIO);                       // 0xB5 - Set GPIO
-        sendData(0x00);                             // Input disabled
-
-        sendCommand(FUNCSEL);                       // 0xAB - Function Selection
-        sendData(0x01);                             // Enable internal VDD regulator
-
-        sendCommand(DISPLAYENHA);                   // 0xB4 - Display Enhancement A
-        sendData(0xA0);                             // Enable external VSL
-        sendData(0xFD);                             // Enhanced low GS display quality
-
-        sendCommand(MASTERCONTRAST);                // 0xC7 - Master Contrast
-        sendData(0x0F);                             // Maximum contrast
-
-        sendCommand(PHASELEN);                      // 0xB1 - Set Phase Length
-        sendData(0xE2);                             // Phase 1: 5 DCLKs, Phase 2: 14 DCLKs
-
-        sendCommand(DISPLAYENHB);                   // 0xD1 - Display Enhancement B
-        sendData(0xA2);
-        sendData(0x20);
-
-        sendCommand(PRECHARGE);                     // 0xBB - Precharge Voltage
-        sendData(0x1F);                             // 0.6 x VCC
-
-        sendCommand(PRECHARGE2);                    // 0xB6 - Second Precharge Period
-        sendData(0x08);                             // 8 DCLKs
-
-        sendCommand(SETVCOM);                       // 0xBE - VCOMH Voltage
-        sendData(0x07);                             // 0.86 x VCC
-
-        setNormalDisplay(); // Set normal display mode
-
-        sendCommand(EXITPARTDISPLAY);               // 0xA9 - Exit Partial Display mode
-
-        setContrast(0x50); // Set default contrast
-
-        sendCommand(DISPLAYON);                     // 0xAF - Display ON
+        CommandSequence sequence;
+        sequence
+            .command(CMDLOCK, {0x12})               // 0xFD - Command Lock: unlock OLED driver IC
+            .command(DISPLAYOFF)                    // 0xAE - Display OFF
+            .command(DISPLAYCLK, {0x91})            // 0xB3 - Set Display Clock Divide Ratio/Oscillator Frequency: divide by 2, ~80 FPS
+            .command(SETMULTIPLEX, {0x3F})          // 0xCA - Set Multiplex Ratio: 1/64
+            .command(SETDISPLAYOFFSET, {0x00})      // 0xA2 - Set Display Offset: no offset
+            .command(SETSTARTLINE, {0x00})          // 0xA1 - Set Display Start Line: line 0
+            .command(SEGREMAP, {0x14, 0x11})        // 0xA0 - Set Remap and Dual COM Mode: horizontal increment, nibble remap; dual COM mode
+            .command(SETGPIO, {0x00})               // 0xB5 - Set GPIO: input disabled
+            .command(FUNCSEL, {0x01})               // 0xAB - Function Selection: enable internal VDD regulator
+            .command(DISPLAYENHA, {0xA0, 0xFD})     // 0xB4 - Display Enhancement A: enable external VSL; enhanced low GS display quality
+            .command(MASTERCONTRAST, {0x0F})        // 0xC7 - Master Contrast: maximum contrast
+            .command(PHASELEN, {0xE2})              // 0xB1 - Set Phase Length: phase 1: 5 DCLKs, phase 2: 14 DCLKs
+            .command(DISPLAYENHB, {0xA2, 0x20})     // 0xD1 - Display Enhancement B
+            .command(PRECHARGE, {0x1F})             // 0xBB - Precharge Voltage: 0.6 x VCC
+            .command(PRECHARGE2, {0x08})            // 0xB6 - Second Precharge Period: 8 DCLKs
+            .command(SETVCOM, {0x07})               // 0xBE - VCOMH Voltage: 0.86 x VCC
+            .command(NORMALDISPLAY)                 // 0xA6 - Set normal display mode
+            .command(EXITPARTDISPLAY)               // 0xA9 - Exit Partial Display mode
+            .command(SETCONTRAST, {0x50})           // 0xC1 - Set default contrast
+            .command(DISPLAYON);                    // 0xAF - Display ON
+        send(sequence);
     }
 
     void SSD1322::setContrast(uint8_t contrast) {
-        sendCommand(SETCONTRAST);
-        sendData(contrast);
+        CommandSequence sequence;
+        sequence.command(SETCONTRAST, {contrast});
+        send(sequence);
     }
 
     void SSD1322::allPixelsOn() {
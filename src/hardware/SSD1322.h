@@ -2,7 +2,11 @@
 
 #ifdef RASPBERRY_PI
 
+#include <array>
+#include <chrono>
 #include <cstdint>
+#include <initializer_list>
+#include <stdexcept>
 
 #include "GPIO.h"
 #include "SPI.h"
@@ -22,6 +26,12 @@ namespace PiAlarm::hardware {
      *
      * The SSD1322 is a monochrome OLED display controller with a resolution of 256x64 pixels.
      *
+     * The level of the DC (data/command) pin is tracked, so it is only written when it changes.
+     * Commands and their arguments can be grouped in a CommandSequence, sent with one SPI transfer
+     * per run of bytes sharing the same DC level. The RAM write window set by a flush is also remembered:
+     * flushing the same region again only sends the pixels, the controller still being in RAM write mode
+     * with its address pointer back at the start of the window.
+     *
      * Mostly based on the venice1200/SSD1322_for_Adafruit_GFX library.
      * (https://github.com/venice1200/SSD1322_for_Adafruit_GFX)
      *
@@ -39,6 +49,89 @@ namespace PiAlarm::hardware {
         static constexpr size_t DISPLAY_WIDTH {256}; ///< Width of the SSD1322 display in pixels
         static constexpr size_t DISPLAY_HEIGHT {64}; ///< Height of the SSD1322 display in pixels
 
+        /**
+         * @struct FlushTiming
+         * @brief Measured durations of the flushes, with the time their bytes need on the SPI line.
+         *
+         * The line time is the lower bound of the flush duration at the SPI clock rate:
+         * the difference is the cost of the syscalls, the DC line toggles and the driver.
+         */
+        struct FlushTiming {
+            size_t flushes {0}; ///< Number of flushes
+            size_t bytes {0}; ///< Bytes sent by the flushes, commands included
+            size_t messages {0}; ///< SPI ioctls made by the flushes
+            std::chrono::nanoseconds last {0}; ///< Duration of the last flush
+            std::chrono::nanoseconds max {0}; ///< Duration of the longest flush
+            std::chrono::nanoseconds total {0}; ///< Sum of the flush durations
+            std::chrono::nanoseconds lineTime {0}; ///< Time the bytes of the flushes take on the line at the SPI clock rate
+        };
+
+        /**
+         * @class CommandSequence
+         * @brief Commands and their argument bytes, built before being sent with SSD1322::send.
+         *
+         * Bytes are grouped into runs of the same DC level: the arguments of a command form a data run,
+         * and consecutive commands without arguments share a command run. Each run is one SPI transfer,
+         * and the DC pin only changes between runs. The sequence is stored inline and does not allocate.
+         */
+        class CommandSequence {
+        public:
+            static constexpr size_t CAPACITY {64}; ///< Maximum number of bytes in a sequence
+
+            /**
+             * @struct Run
+             * @brief Consecutive bytes of a sequence sent with the same DC level.
+             */
+            struct Run {
+                const DataByte* bytes; ///< Pointer to the first byte of the run
+                size_t length; ///< Number of bytes in the run
+                bool isData; ///< True for argument bytes (DC high), false for command bytes (DC low)
+            };
+
+        private:
+            std::array<DataByte, CAPACITY> bytes_ {}; ///< Bytes of the sequence, in sending order
+            std::array<size_t, CAPACITY> runEnds_ {}; ///< Index after the last byte of each run
+            size_t size_ {0}; ///< Number of bytes in the sequence
+            size_t runCount_ {0}; ///< Number of runs in the sequence
+            bool lastIsData_ {false}; ///< DC level of the last run
+
+        public:
+
+            /**
+             * @brief Appends a command and its arguments to the sequence.
+             * @param cmd The command byte.
+             * @param args The argument bytes of the command.
+             * @return A reference to this sequence, for chaining.
+             * @throws std::runtime_error if the sequence capacity is exceeded.
+             */
+            inline CommandSequence& command(CommandByte cmd, std::initializer_list<DataByte> args = {});
+
+            /**
+             * @brief Gets the number of runs of the sequence.
+             * @return The number of runs, each one sent with one SPI transfer.
+             */
+            [[nodiscard]]
+            inline size_t getRunCount() const;
+
+            /**
+             * @brief Gets a run of the sequence.
+             * @param index The index of the run, less than getRunCount().
+             * @return The run.
+             */
+            [[nodiscard]]
+            inline Run getRun(size_t index) const;
+
+        private:
+
+            /**
+             * @brief Appends a byte, starting a new run if its DC level differs from the previous byte.
+             * @param byte The byte to append.
+             * @param isData True for an argument byte, false for a command byte.
+             * @throws std::runtime_error if the sequence is full.
+             */
+            inline void append(DataByte byte, bool isData);
+        };
+
         /**
          * @brief Constructs an SSD1322 object, creating and taking ownership of SPI and GPIO resources.
          *
@@ -96,6 +189,15 @@ namespace PiAlarm::hardware {
          */
         void sendData(const DataByte* data, size_t length);
 
+        /**
+         * @brief Sends a sequence of commands and arguments to the SSD1322 display.
+         *
+         * Each run of the sequence is sent with one SPI transfer, the DC pin being set only when it changes.
+         *
+         * @param sequence The commands to send.
+         */
+        void send(const CommandSequence& sequence);
+
         /**
          * @brief Transfers a 4-bit grayscale framebuffer to the SSD1322 display.
          *
@@ -108,6 +210,24 @@ namespace PiAlarm::hardware {
          */
         void flush(const uint8_t* buffer, size_t size);
 
+        /**
+         * @brief Transfers a region of a 4-bit grayscale framebuffer to the SSD1322 display.
+         *
+         * This method restricts the display write window to the given region with the SETCOLUMN/SETROW commands,
+         * then sends only the bytes of that region. The horizontal bounds are widened to the SSD1322 column
+         * granularity (4 pixels), and the region is clipped to the display size.
+         * If the window is the one of the previous flush and no command was sent since, only the pixels are sent.
+         *
+         * @param buffer Pointer to the full framebuffer (must be 4 bits per pixel, packed: 2 pixels per byte).
+         * @param size The size of the full framebuffer in bytes.
+         * @param x The x-coordinate of the top-left corner of the region, in pixels.
+         * @param y The y-coordinate of the top-left corner of the region, in pixels.
+         * @param width The width of the region in pixels.
+         * @param height The height of the region in pixels.
+         * @note Does nothing if the region is empty.
+         */
+        void flushRegion(const uint8_t* buffer, size_t size, size_t x, size_t y, size_t width, size_t height);
+
         /**
          * @brief Sets the contrast of the SSD1322 display.
          * @param contrast The contrast value to set (0-255).
@@ -140,6 +260,13 @@ namespace PiAlarm::hardware {
          */
         void setNormalDisplay();
 
+        /**
+         * @brief Gets the measured durations of the flushes since the display was created.
+         * @return The flush timing.
+         */
+        [[nodiscard]]
+        inline const FlushTiming& getFlushTiming() const;
+
     private:
         // SSD1322 Command Definitions
         // Adapted from https://github.com/venice1200/SSD1322_for_Adafruit_GFX/blob/v0.1.2/SSD1322_for_Adafruit_GFX.h
@@ -182,22 +309,108 @@ namespace PiAlarm::hardware {
         static constexpr uint8_t COLUMN_END {0x5B}; ///< End column for the display buffer (91 in decimal, 256 pixels / 4 bits per pixel = 64 columns, so 0x5B = 28 + 64 - 1 = 91)
         static constexpr uint8_t ROW_START {0x00}; ///< Start row for the display buffer
         static constexpr uint8_t ROW_END {0x3F}; ///< End row for the display buffer (63 in decimal)
+        static constexpr size_t PIXELS_PER_COLUMN {4}; ///< Number of pixels addressed by one SSD1322 column (2 bytes of 4-bit pixels)
+        static constexpr size_t ROW_BYTES {DISPLAY_WIDTH / 2}; ///< Number of bytes in a row of the framebuffer (4 bits per pixel)
+
+        std::array<DataByte, DISPLAY_HEIGHT * ROW_BYTES> regionBuffer_ {}; ///< Staging buffer used to send a partial region in one transfer
+        int dcLevel_ {-1}; ///< Current level of the DC pin, -1 while unknown
+        std::array<DataByte, 4> window_ {}; ///< Start and end columns then rows of the RAM write window set by the last flush
+        bool ramWriteReady_ {false}; ///< Whether data bytes go to the RAM at the start of window_ (ENWRITEDATA was the last command, the window was written completely)
+        FlushTiming flushTiming_; ///< Measured durations of the flushes
+
+        /**
+         * @brief Adds a flush to the flush timing.
+         * @param start The time the flush started.
+         * @param messageCountBefore The SPI message count before the flush.
+         * @param bytesWrittenBefore The SPI byte count before the flush.
+         */
+        void recordFlush(std::chrono::steady_clock::time_point start, size_t messageCountBefore, size_t bytesWrittenBefore);
 
         /**
          * @brief Sets the DC pin to command mode.
          *
          * This method is used to indicate that the next byte sent is a command.
+         * The pin is only written if it is not already low.
          */
-        void setDCPinCommand();
+        inline void setDCPinCommand();
 
         /**
          * @brief Sets the DC pin to data mode.
          *
          * This method is used to indicate that the next byte sent is data.
+         * The pin is only written if it is not already high.
+         */
+        inline void setDCPinData();
+
+        /**
+         * @brief Sets the DC pin level, if it differs from the current one.
+         * @param level GPIO::LOW for a command, GPIO::HIGH for data.
+         */
+        inline void setDCPin(int level);
+
+        /**
+         * @brief Sends pixel bytes to the display RAM, in data mode.
+         * Unlike sendData, the RAM write state is kept.
+         * @param data Pointer to the pixel bytes.
+         * @param length The number of bytes to send.
          */
-        void setDCPinData();
+        void sendPixels(const DataByte* data, size_t length);
     };
 
+    // Inline methods implementation
+
+    inline const SSD1322::FlushTiming& SSD1322::getFlushTiming() const {
+        return flushTiming_;
+    }
+
+    inline void SSD1322::setDCPinCommand() {
+        setDCPin(GPIO::LOW);
+    }
+
+    inline void SSD1322::setDCPinData() {
+        setDCPin(GPIO::HIGH);
+    }
+
+    inline void SSD1322::setDCPin(int level) {
+        if (dcLevel_ == level) return; // avoid a GPIO write
+
+        dcLevel_ = -1; // unknown if the write fails
+        dcPin_.set(level);
+        dcLevel_ = level;
+    }
+
+    inline SSD1322::CommandSequence& SSD1322::CommandSequence::command(CommandByte cmd, std::initializer_list<DataByte> args) {
+        append(cmd, false);
+        for (DataByte arg : args) {
+            append(arg, true);
+        }
+        return *this;
+    }
+
+    inline size_t SSD1322::CommandSequence::getRunCount() const {
+        return runCount_;
+    }
+
+    inline SSD1322::CommandSequence::Run SSD1322::CommandSequence::getRun(size_t index) const {
+        const size_t begin = index == 0 ? 0 : runEnds_[index - 1];
+        // runs alternate between command and data, the first one being a command
+        return {bytes_.data() + begin, runEnds_[index] - begin, index % 2 == 1};
+    }
+
+    inline void SSD1322::CommandSequence::append(DataByte byte, bool isData) {
+        if (size_ == CAPACITY) {
+            throw std::runtime_error("SSD1322 command sequence is full");
+        }
+
+        if (runCount_ == 0 || isData != lastIsData_) {
+            ++runCount_; // new run
+            lastIsData_ = isData;
+        }
+
+        bytes_[size_++] = byte;
+        runEnds_[runCount_ - 1] = size_;
+    }
+
 } // namespace PiAlarm::hardware
 
 #endif // RASPBERRY_PI
\ No newline at end of file
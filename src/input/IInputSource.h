@@ -0,0 +1,58 @@
+#pragma once
+
+#include <chrono>
+#include <optional>
+#include <vector>
+
+#include "InputEvent.h"
+
+namespace PiAlarm::input {
+
+    /**
+     * @interface IInputSource
+     * @brief Interface for the sources of input events.
+     *
+     * A source is polled by an InputWorker thread, which sleeps in between: it tells what to wait for
+     * with its file descriptors and the time of its next event that no file descriptor signals.
+     * Implemented by InputManager (GPIO buttons), ReplayInputSource (event script) and InputRecorder (records another source).
+     */
+    class IInputSource {
+    public:
+        using EventList = std::vector<InputEvent>; ///< Alias for a list of input events
+        using TimePoint = std::chrono::steady_clock::time_point; ///< Alias for the time of an event
+
+        /**
+         * @brief Virtual destructor for the interface.
+         * Ensures proper cleanup of derived classes.
+         */
+        virtual ~IInputSource() = default;
+
+        /**
+         * @brief Initializes the source, before the first poll.
+         * @throw std::runtime_error if the source cannot be initialized.
+         */
+        virtual void init() = 0;
+
+        /**
+         * @brief Polls for the input events that happened since the last poll.
+         * @return The events, in the order they happened.
+         */
+        virtual EventList pollEvents() = 0;
+
+        /**
+         * @brief Gets the file descriptors becoming readable when the source has events.
+         * @return The file descriptors to wait on, empty if the source has none.
+         */
+        [[nodiscard]]
+        virtual std::vector<int> getEventFds() const = 0;
+
+        /**
+         * @brief Gets the time of the next event not signaled by a file descriptor (e.g. an auto-repeat).
+         * pollEvents() must be called at that time.
+         * @return The time of the next such event, empty if none is expected.
+         */
+        [[nodiscard]]
+        virtual std::optional<TimePoint> getNextEventTime() const = 0;
+    };
+
+} // namespace PiAlarm::input
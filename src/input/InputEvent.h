@@ -1,5 +1,7 @@
 #pragma once
 
+#include <chrono>
+
 namespace PiAlarm::input {
 
     /**
@@ -26,6 +28,7 @@ namespace PiAlarm::input {
     struct InputEvent {
         ButtonId button; ///< The ID of the button that triggered the event
         bool pressed; ///< True if the button was pressed, false if it was released
+        std::chrono::steady_clock::time_point timestamp {}; ///< The time of the edge, or the time an auto-repeat was due
     };
 
 } // namespace PiAlarm::input
\ No newline at end of file
@@ -1,74 +1,108 @@
+#include <algorithm>
+
 #include "InputManager.h"
 
 namespace PiAlarm::input {
 
-    InputManager::InputManager(const std::vector<ButtonConfig>& buttonsConfig) {
+    InputManager::InputManager(const std::vector<ButtonConfig>& buttonsConfig)
+        : lines_{getGPIOConfigs(buttonsConfig)}
+    {
         buttons_.reserve(buttonsConfig.size());
 
         for (const auto& buttonConfig : buttonsConfig) {
-            buttons_.emplace_back(std::make_unique<ManagedButton>(buttonConfig));
+            buttons_.emplace_back(buttonConfig);
         }
     }
 
     void InputManager::init() {
-        for (const auto& btnPtr : buttons_) {
-            btnPtr->gpio.setInputWithEdgeDetection(hardware::GPIO::EdgeType::BOTH);
-        }
+        lines_.requestBothEdgesEvents();
     }
 
     InputManager::EventList InputManager::pollEvents() {
-        const auto now = std::chrono::steady_clock::now();
-
         EventList events;
 
-        // Read the state of each button and generate events
-        for (const auto& btnPtr : buttons_) {
-            auto& button = *btnPtr;
-            readButton(button, events, now); // Read the button state and generate press/release events
+        // Read the edges of every button and generate press/release events, in the order they happened
+        lineEvents_.clear();
+        lines_.readEvents(lineEvents_);
 
+        for (const auto& lineEvent : lineEvents_) {
+            handleEdge(buttons_[lineEvent.lineIndex], lineEvent.event, events);
+        }
+
+        // Generate auto-repeat events for the buttons still pressed
+        const auto now = std::chrono::steady_clock::now();
+        for (auto& button : buttons_) {
             if (button.generateRepeats)
-                generateRepeats(button, events, now); // Generate auto-repeat events if the button is pressed
+                generateRepeats(button, events, now);
         }
 
         return events;
     }
 
-    void InputManager::readButton(ManagedButton& button, EventList &events, now_type now) {
-        while (button.gpio.waitForEvent(0)) { // while there are events | 0 for non-blocking
-            hardware::GPIOEvent event = button.gpio.readEvent();
-            bool pressed = (event.type == hardware::GPIOEvent::Type::RisingEdge);
+    std::vector<int> InputManager::getEventFds() const {
+        return lines_.getEventFds();
+    }
 
-            if (button.pressed == pressed) {
-                // If the button state hasn't changed, skip generating an event
-                continue;
-            }
+    std::optional<InputManager::TimePoint> InputManager::getNextEventTime() const {
+        std::optional<now_type> next;
 
-            button.pressed = pressed;
+        for (const auto& button : buttons_) {
+            if (!button.generateRepeats || !button.pressed) continue;
 
-            if (now - button.lastEventTime < DEBOUNCE_DURATION) {
-                // If the event is too close to the last event, skip it to avoid flooding
-                continue;
-            }
+            const auto due = getRepeatDueTime(button);
+            if (!next || due < *next) next = due;
+        }
+        return next;
+    }
 
-            if (pressed) {
-                button.lastPressTime = now;
-                button.lastRepeatTime = now;
-            }
-            button.lastEventTime = now;
+    std::vector<hardware::GPIOConfig> InputManager::getGPIOConfigs(const std::vector<ButtonConfig>& buttonsConfig) {
+        std::vector<hardware::GPIOConfig> configs;
+        configs.reserve(buttonsConfig.size());
 
-            events.push_back({ button.type, pressed });
+        for (const auto& buttonConfig : buttonsConfig) {
+            configs.push_back(buttonConfig.gpioConfig);
         }
+        return configs;
     }
 
-    void InputManager::generateRepeats(ManagedButton& button, EventList &events, now_type now) {
-        if (button.pressed) {
-            if (now - button.lastPressTime >= REPEAT_DELAY &&
-                now - button.lastRepeatTime >= REPEAT_INTERVAL)
-            {
-                events.push_back({ button.type, true }); // repeat event
-                button.lastRepeatTime = now;
-            }
+    void InputManager::handleEdge(ManagedButton& button, const hardware::GPIOEvent& edge, EventList &events) {
+        bool pressed = (edge.type == hardware::GPIOEvent::Type::RisingEdge);
+
+        if (button.pressed == pressed) {
+            // If the button state hasn't changed, skip generating an event
+            return;
         }
+
+        button.pressed = pressed;
+
+        if (edge.timestamp - button.lastEventTime < DEBOUNCE_DURATION) {
+            // If the edge is too close to the last event, it is a bounce
+            return;
+        }
+
+        if (pressed) {
+            button.lastPressTime = edge.timestamp;
+            button.lastRepeatTime = edge.timestamp;
+        }
+        button.lastEventTime = edge.timestamp;
+
+        events.push_back({ button.type, pressed, edge.timestamp });
+    }
+
+    void InputManager::generateRepeats(ManagedButton& button, EventList &events, now_type now) {
+        if (!button.pressed) return;
+
+        const auto due = getRepeatDueTime(button);
+        if (now < due) return;
+
+        events.push_back({ button.type, true, due }); // repeat event
+
+        // Keep the cadence of the press: the repeats missed by a late poll are skipped
+        button.lastRepeatTime = due + (now - due) / REPEAT_INTERVAL * REPEAT_INTERVAL;
+    }
+
+    InputManager::now_type InputManager::getRepeatDueTime(const ManagedButton& button) {
+        return std::max(button.lastPressTime + REPEAT_DELAY, button.lastRepeatTime + REPEAT_INTERVAL);
     }
 
 } // namespace PiAlarm::input
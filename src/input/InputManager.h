@@ -2,10 +2,10 @@
 
 #include <vector>
 #include <chrono>
-#include <memory>
+#include <optional>
 
-#include "InputEvent.h"
-#include "hardware/GPIO.h"
+#include "IInputSource.h"
+#include "hardware/GPIOLines.h"
 
 /**
  * @namespace PiAlarm::input
@@ -20,9 +20,9 @@ namespace PiAlarm::input {
      * @brief Manages input events from GPIO buttons.
      *
      * This class handles the state of multiple buttons, detects button presses,
-     * and generates input events for the application.
+     * and generates input events for the application. It is the GPIO input source.
      */
-    class InputManager {
+    class InputManager final : public IInputSource {
     public:
 
         /**
@@ -47,27 +47,27 @@ namespace PiAlarm::input {
          * @struct ManagedButton
          * @brief Represents a button managed by the InputManager.
          *
-         * This struct contains the GPIO object, button type, pressed state,
+         * This struct contains the button type, pressed state,
          * auto-repeat settings, and timestamps for press and repeat events.
+         * The GPIO line of the button is held by the InputManager, at the same index.
          */
         struct ManagedButton {
-            hardware::GPIO gpio; ///< The GPIO object for the button
             ButtonId type; ///< The type of button (Main, Back, Left, Right).
             bool pressed = false; ///< True if the button is currently pressed, false otherwise
             bool generateRepeats; ///< Whether to generate auto-repeat events for this button
-            std::chrono::steady_clock::time_point lastPressTime; ///< The last time the button was pressed
-            std::chrono::steady_clock::time_point lastRepeatTime; ///< The last time the button was repeated for auto-repeat
-            std::chrono::steady_clock::time_point lastEventTime; ///< The last time an event was generated for this button
+            std::chrono::steady_clock::time_point lastPressTime; ///< The time of the last press edge
+            std::chrono::steady_clock::time_point lastRepeatTime; ///< The time the last auto-repeat was due
+            std::chrono::steady_clock::time_point lastEventTime; ///< The time of the last edge an event was generated for
 
             /**
              * @brief Constructs a Button from a ButtonMapping.
              *
-             * This constructor initializes the button with its GPIO and type.
+             * This constructor initializes the button with its type and repeat setting.
              *
              * @param mapping The ButtonMapping containing the GPIO and type for the button
              */
             explicit ManagedButton(const ButtonConfig& mapping)
-                : gpio{mapping.gpioConfig}, type{mapping.type}, generateRepeats{mapping.generateRepeats} {}
+                : type{mapping.type}, generateRepeats{mapping.generateRepeats} {}
         };
 
         static constexpr auto REPEAT_DELAY {std::chrono::milliseconds(500)};    ///< Delay before auto-repeat starts
@@ -76,10 +76,11 @@ namespace PiAlarm::input {
 
         using now_type = std::chrono::steady_clock::time_point; ///< Alias for the current time point type
 
-        std::vector<std::unique_ptr<ManagedButton>> buttons_; ///< List of buttons managed by the InputManager
+        std::vector<ManagedButton> buttons_; ///< List of buttons managed by the InputManager
+        hardware::GPIOLines lines_; ///< The GPIO lines of the buttons, in the order of buttons_
+        std::vector<hardware::GPIOLineEvent> lineEvents_; ///< Edges read from the lines, reused by each poll
 
     public:
-        using EventList = std::vector<InputEvent>; ///< Alias for a list of input events
 
         /**
          * @brief Constructs an InputManager with a list of button configurations.
@@ -87,52 +88,88 @@ namespace PiAlarm::input {
          * This constructor initializes the InputManager with the provided button configurations,
          * setting up each button for input event handling.
          *
-         * @param buttonsConfig A vector of ButtonConfig objects representing the buttons to manage
+         * @param buttonsConfig A vector of ButtonConfig objects representing the buttons to manage, all on the same GPIO chip
+         * @throw std::invalid_argument if the buttons are not on the same GPIO chip.
+         * @throw std::runtime_error if the GPIO chip or a line cannot be opened.
          */
         explicit InputManager(const std::vector<ButtonConfig>& buttonsConfig);
 
         /**
          * @brief Initializes the InputManager.
-         * @throw std::runtime_error if any GPIO line cannot be initialized.
+         * The button lines are requested for edge events together.
+         * @throw std::runtime_error if the GPIO lines cannot be initialized.
          */
-        void init();
+        void init() override;
 
         /**
          * @brief Polls for input events from the GPIO buttons.
          *
-         * This method checks the state of each button, reads any events that have occurred,
+         * This method reads the edges detected on every button line since the last poll, with a single wait,
          * and generates input events based on the button states. It also handles auto-repeat
          * functionality for buttons that are held down.
+         * Debounce and auto-repeat use the time the kernel detected each edge, not the time of the poll.
          *
          * @return A vector of InputEvent objects representing the input events detected
          */
-        EventList pollEvents();
+        EventList pollEvents() override;
+
+        /**
+         * @brief Gets the file descriptors signaling the button events.
+         * A descriptor becomes readable when its button changes state, then pollEvents() must be called.
+         * init() must have been called before.
+         * @return The event file descriptor of each button.
+         * @throws std::runtime_error if a descriptor cannot be retrieved.
+         */
+        [[nodiscard]]
+        std::vector<int> getEventFds() const override;
+
+        /**
+         * @brief Gets the time of the next auto-repeat event.
+         * No file descriptor signals repeats: pollEvents() must be called at that time while a button is held.
+         * @return The time the next repeat is due, empty if no repeating button is pressed.
+         */
+        [[nodiscard]]
+        std::optional<TimePoint> getNextEventTime() const override;
 
     private:
 
         /**
-         * @brief Reads the state of a button and generates input events.
+         * @brief Gets the GPIO configuration of each button.
+         * @param buttonsConfig The button configurations.
+         * @return The GPIO configurations, in the same order.
+         */
+        static std::vector<hardware::GPIOConfig> getGPIOConfigs(const std::vector<ButtonConfig>& buttonsConfig);
+
+        /**
+         * @brief Updates the state of a button with an edge of its line and generates input events.
          *
-         * This method checks the GPIO state of a button, updates its pressed state,
-         * and generates input events based on the button's current state.
+         * This method updates the pressed state of a button,
+         * and generates an input event if the state changed and the edge is not a bounce.
          *
-         * @param button The Button struct representing the button to read
+         * @param button The Button struct representing the button the edge was detected on
+         * @param edge The edge, with the time the kernel detected it
          * @param events The vector to store generated input events
-         * @param now The current time point for event timestamping
          */
-        static void readButton(ManagedButton& button, EventList &events, now_type now);
+        static void handleEdge(ManagedButton& button, const hardware::GPIOEvent& edge, EventList &events);
 
         /**
          * @brief Generates auto-repeat events for a button that is currently pressed.
          *
-         * This method checks if the button is pressed and if the time since the last press
-         * exceeds the repeat delay and interval. If so, it generates a repeat event.
+         * This method checks if a repeat is due, counting from the press edge. If so, it generates a repeat event
+         * stamped with the time it was due. When polled late, the missed repeats are skipped, not sent in a burst.
          *
          * @param button The Button struct representing the button to generate repeats for
          * @param events The vector to store generated input events
-         * @param now The current time point for event timestamping
+         * @param now The current time point
          */
         static void generateRepeats(ManagedButton& button, EventList &events, now_type now);
+
+        /**
+         * @brief Gets the time the next auto-repeat of a pressed button is due.
+         * @param button The pressed button.
+         * @return The time of the next repeat.
+         */
+        static now_type getRepeatDueTime(const ManagedButton& button);
     };
 
 } // namespace PiAlarm::input
\ No newline at end of file
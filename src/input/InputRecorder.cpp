@@ -0,0 +1,51 @@
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+#include "InputRecorder.h"
+#include "InputScript.h"
+
+namespace PiAlarm::input {
+
+    InputRecorder::InputRecorder(std::unique_ptr<IInputSource> source, const std::filesystem::path& path)
+        : source_{std::move(source)}, file_{path, std::ios::trunc}
+    {
+        if (!file_) {
+            throw std::runtime_error("Unable to create input script: " + path.string());
+        }
+    }
+
+    void InputRecorder::init() {
+        source_->init();
+        start_ = std::chrono::steady_clock::now();
+
+        file_ << "# PiAlarm input session: milliseconds since the start, button, down/up\n";
+        file_.flush();
+    }
+
+    IInputSource::EventList InputRecorder::pollEvents() {
+        auto events {source_->pollEvents()};
+        if (events.empty()) return events;
+
+        for (const auto& event : events) {
+            // An edge detected just before the start is recorded at the start
+            const auto offset = std::max(
+                std::chrono::duration_cast<std::chrono::microseconds>(event.timestamp - start_),
+                std::chrono::microseconds{0}
+            );
+            InputScript::write(file_, {offset, event.button, event.pressed});
+        }
+        file_.flush();
+
+        return events;
+    }
+
+    std::vector<int> InputRecorder::getEventFds() const {
+        return source_->getEventFds();
+    }
+
+    std::optional<IInputSource::TimePoint> InputRecorder::getNextEventTime() const {
+        return source_->getNextEventTime();
+    }
+
+} // namespace PiAlarm::input
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <filesystem>
+#include <fstream>
+#include <memory>
+
+#include "IInputSource.h"
+
+namespace PiAlarm::input {
+
+    /**
+     * @class InputRecorder
+     * @brief Input source writing the events of another source to a script, while passing them through.
+     *
+     * Wrapping the GPIO source captures a real session, which ReplayInputSource can play back later.
+     * Times are written relative to init(), from the event timestamps (the edge times for GPIO events).
+     * The file is flushed after each poll returning events, so an interrupted session keeps what was recorded.
+     */
+    class InputRecorder final : public IInputSource {
+        std::unique_ptr<IInputSource> source_; ///< The recorded source
+        std::ofstream file_; ///< The script being written
+        TimePoint start_ {}; ///< Time the session started at
+
+    public:
+
+        /**
+         * @brief Constructs a recorder of a source.
+         * @param source The source to record, owned by the recorder.
+         * @param path Path of the script to write, replaced if it exists.
+         * @throw std::runtime_error if the file cannot be created.
+         */
+        InputRecorder(std::unique_ptr<IInputSource> source, const std::filesystem::path& path);
+
+        /**
+         * @brief Initializes the recorded source and starts the session clock.
+         */
+        void init() override;
+
+        /**
+         * @brief Polls the recorded source and writes its events.
+         * @return The events of the recorded source.
+         */
+        EventList pollEvents() override;
+
+        /**
+         * @brief Gets the file descriptors of the recorded source.
+         * @return The file descriptors to wait on.
+         */
+        [[nodiscard]]
+        std::vector<int> getEventFds() const override;
+
+        /**
+         * @brief Gets the time of the next event of the recorded source.
+         * @return The time of the next event not signaled by a file descriptor.
+         */
+        [[nodiscard]]
+        std::optional<TimePoint> getNextEventTime() const override;
+    };
+
+} // namespace PiAlarm::input
@@ -0,0 +1,88 @@
+#include <array>
+#include <charconv>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include "InputScript.h"
+
+namespace PiAlarm::input {
+
+    namespace {
+
+        constexpr std::array<std::pair<ButtonId, std::string_view>, 4> BUTTON_NAMES {{
+            {ButtonId::Main, "Main"},
+            {ButtonId::Back, "Back"},
+            {ButtonId::Previous, "Previous"},
+            {ButtonId::Next, "Next"}
+        }};
+
+    } // namespace
+
+    std::vector<ScriptedInput> InputScript::load(const std::filesystem::path& path) {
+        std::ifstream file{path};
+        if (!file) {
+            throw std::runtime_error("Unable to open input script: " + path.string());
+        }
+        return parse(file);
+    }
+
+    std::vector<ScriptedInput> InputScript::parse(std::istream& stream) {
+        std::vector<ScriptedInput> inputs;
+        std::string line;
+        size_t lineNumber {0};
+
+        while (std::getline(stream, line)) {
+            ++lineNumber;
+
+            std::istringstream fields{line};
+            std::string first;
+            if (!(fields >> first) || first.front() == '#') continue; // blank line or comment
+
+            double milliseconds {};
+            const char* end = first.data() + first.size();
+            const auto [last, error] = std::from_chars(first.data(), end, milliseconds);
+            const bool validTime = error == std::errc{} && last == end && milliseconds >= 0;
+
+            std::string buttonName, state, extra;
+            fields >> buttonName >> state;
+            const auto button = parseButtonName(buttonName);
+
+            if (!validTime || !button || (state != "down" && state != "up") || (fields >> extra)) {
+                throw std::runtime_error("Invalid input script line " + std::to_string(lineNumber) + ": " + line);
+            }
+
+            inputs.push_back({
+                std::chrono::microseconds{static_cast<int64_t>(milliseconds * 1000.0 + 0.5)},
+                *button,
+                state == "down"
+            });
+        }
+        return inputs;
+    }
+
+    void InputScript::write(std::ostream& stream, const ScriptedInput& input) {
+        const auto us = input.offset.count();
+        stream << us / 1000 << '.' << std::setw(3) << std::setfill('0') << us % 1000 << std::setfill(' ')
+               << ' ' << getButtonName(input.button)
+               << ' ' << (input.pressed ? "down" : "up") << '\n';
+    }
+
+    std::string_view InputScript::getButtonName(ButtonId button) {
+        for (const auto& [id, name] : BUTTON_NAMES) {
+            if (id == button) return name;
+        }
+        return "Unknown";
+    }
+
+    std::optional<ButtonId> InputScript::parseButtonName(std::string_view name) {
+        for (const auto& [id, buttonName] : BUTTON_NAMES) {
+            if (buttonName == name) return id;
+        }
+        return std::nullopt;
+    }
+
+} // namespace PiAlarm::input
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <chrono>
+#include <filesystem>
+#include <iosfwd>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+#include "InputEvent.h"
+
+namespace PiAlarm::input {
+
+    /**
+     * @struct ScriptedInput
+     * @brief An input event of a script, timed from the start of the session.
+     */
+    struct ScriptedInput {
+        std::chrono::microseconds offset; ///< Time of the event since the start of the session
+        ButtonId button; ///< The button of the event
+        bool pressed; ///< True for a press (or an auto-repeat), false for a release
+    };
+
+    /**
+     * @class InputScript
+     * @brief Reads and writes the text format of recorded input sessions.
+     *
+     * A script has one event per line: the time in milliseconds since the start of the session,
+     * the button name and "down" or "up", separated by spaces. Blank lines and lines starting with '#' are ignored.
+     * @code
+     * # enter the alarm settings and move to the next field
+     * 1200.000 Main down
+     * 1310.250 Main up
+     * 2004.5 Next down
+     * @endcode
+     */
+    class InputScript {
+    public:
+        InputScript() = delete;
+
+        /**
+         * @brief Reads a script file.
+         * @param path Path of the file.
+         * @return The events, in the order of the file.
+         * @throw std::runtime_error if the file cannot be read or a line is invalid.
+         */
+        [[nodiscard]]
+        static std::vector<ScriptedInput> load(const std::filesystem::path& path);
+
+        /**
+         * @brief Reads a script from a stream.
+         * @param stream The stream to read until its end.
+         * @return The events, in the order of the stream.
+         * @throw std::runtime_error if a line is invalid.
+         */
+        [[nodiscard]]
+        static std::vector<ScriptedInput> parse(std::istream& stream);
+
+        /**
+         * @brief Writes an event as a script line.
+         * @param stream The stream to write to.
+         * @param input The event.
+         */
+        static void write(std::ostream& stream, const ScriptedInput& input);
+
+        /**
+         * @brief Gets the name of a button, as written in scripts.
+         * @param button The button.
+         * @return The name of the button.
+         */
+        [[nodiscard]]
+        static std::string_view getButtonName(ButtonId button);
+
+        /**
+         * @brief Gets the button of a name written in a script.
+         * @param name The name of the button.
+         * @return The button, empty if the name is unknown.
+         */
+        [[nodiscard]]
+        static std::optional<ButtonId> parseButtonName(std::string_view name);
+    };
+
+} // namespace PiAlarm::input
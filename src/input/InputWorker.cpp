@@ -0,0 +1,76 @@
+#include <cstring>
+
+#ifdef __linux__
+    #include <pthread.h>
+    #include <sched.h>
+#endif
+
+#include "InputWorker.h"
+
+namespace PiAlarm::input {
+
+    InputWorker::InputWorker(IInputSource& source, system::EventLoop& consumerLoop)
+        : HasWorker{"InputWorker"}, source_{source}, consumerLoop_{consumerLoop}
+    {}
+
+    InputWorker::~InputWorker() {
+        stop(); // before the members used by the worker thread are destroyed
+    }
+
+    void InputWorker::stop() {
+        stopping_ = true;
+        sourceLoop_.notify(); // leave the wait, the notification stays pending if the worker is not waiting yet
+
+        stopWorker();
+    }
+
+    bool InputWorker::onWorkerStart() {
+        stopping_ = false;
+
+        #ifdef __linux__
+            // An edge must be read on time even when the UI and display threads are busy
+            sched_param param {};
+            param.sched_priority = THREAD_PRIORITY;
+            if (const int error = pthread_setschedparam(pthread_self(), SCHED_FIFO, &param); error != 0) {
+                logger().warn("Unable to raise the input thread priority, running at normal priority: {}", std::strerror(error));
+            }
+
+            if (!sourceWatched_) {
+                for (int fd : source_.getEventFds()) {
+                    sourceLoop_.watch(fd);
+                }
+                sourceWatched_ = true;
+            }
+        #endif // __linux__
+
+        return true;
+    }
+
+    void InputWorker::workerProcess() {
+        if (stopping_) return;
+
+        size_t queued {0};
+        for (const auto& event : source_.pollEvents()) {
+            if (queue_.tryPush(event)) ++queued;
+        }
+
+        if (queued > 0) consumerLoop_.notify();
+
+        if (const uint64_t dropped = queue_.getDroppedCount(); dropped != reportedDrops_) {
+            logger().warn("Input queue full, {} event(s) dropped ({} in total)", dropped - reportedDrops_, dropped);
+            reportedDrops_ = dropped;
+        }
+    }
+
+    void InputWorker::workerWaitNextCycle() {
+        if (stopping_) return;
+
+        sourceLoop_.wait(source_.getNextEventTime()); // a held button repeats without any GPIO event
+    }
+
+    void InputWorker::onWorkerStop() {
+        logger().info("Events queued: {}, dropped: {}, most waiting at once: {}/{}",
+            queue_.getPushedCount(), queue_.getDroppedCount(), queue_.getHighWatermark(), EventQueue::capacity());
+    }
+
+} // namespace PiAlarm::input
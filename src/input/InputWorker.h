@@ -0,0 +1,113 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+#include "common/HasWorker.h"
+#include "common/SpscQueue.hpp"
+#include "IInputSource.h"
+#include "InputEvent.h"
+#include "system/EventLoop.h"
+
+namespace PiAlarm::input {
+
+    /**
+     * @class InputWorker
+     * @brief Polls an input source from a dedicated high-priority thread and queues its events for the UI thread.
+     *
+     * The worker sleeps on the file descriptors of the source and the time of its next auto-repeat,
+     * so an edge is read and timestamped as soon as it happens, whatever the UI thread is busy with.
+     * The events go through a lock-free single-producer/single-consumer ring, and the event loop
+     * of the UI thread is notified (through its eventfd) when new events are queued.
+     * If the UI thread falls so far behind that the ring is full, the new events are dropped and counted.
+     */
+    class InputWorker final : public common::HasWorker {
+    public:
+        static constexpr size_t QUEUE_CAPACITY {64}; ///< Number of events the UI thread can fall behind by
+        using EventQueue = common::SpscQueue<InputEvent, QUEUE_CAPACITY>; ///< Alias for the queue type
+
+    private:
+        static constexpr int THREAD_PRIORITY {10}; ///< Real-time priority of the worker thread (SCHED_FIFO), above the other threads
+
+        IInputSource& source_; ///< The polled source, only used by the worker thread once started
+        system::EventLoop& consumerLoop_; ///< Event loop of the UI thread, notified when events are queued
+        system::EventLoop sourceLoop_ {false}; ///< Waits for the source, no second ticks needed
+        bool sourceWatched_ {false}; ///< Whether the file descriptors of the source are watched by sourceLoop_
+        std::atomic<bool> stopping_ {false}; ///< Whether stop() was called
+
+        EventQueue queue_; ///< Events waiting for the UI thread
+        uint64_t reportedDrops_ {0}; ///< Number of dropped events already logged, used by the worker thread
+
+    public:
+
+        /**
+         * @brief Constructs a worker polling the given source.
+         * @param source The source, already initialized when the worker is started.
+         * @param consumerLoop The event loop of the thread consuming the events.
+         */
+        InputWorker(IInputSource& source, system::EventLoop& consumerLoop);
+
+        /**
+         * @brief Destructor, stops the worker thread.
+         */
+        ~InputWorker() override;
+
+        /**
+         * @brief Passes the queued events to a function, oldest first. Must be called from the consumer thread only.
+         * @param consume The function called with each event.
+         * @return The number of events passed.
+         */
+        template<typename Consumer>
+        size_t drainEvents(Consumer&& consume);
+
+        /**
+         * @brief Stops the worker thread without waiting for the next event of the source.
+         * Events already queued are kept.
+         */
+        void stop();
+
+        /**
+         * @brief Gets the number of events dropped because the UI thread did not take them in time.
+         * @return The number of dropped events.
+         */
+        [[nodiscard]]
+        inline uint64_t getDroppedEvents() const;
+
+    protected:
+
+        /**
+         * @brief Raises the priority of the worker thread and watches the file descriptors of the source.
+         * @return Always true, the worker runs at the normal priority if it cannot be raised.
+         */
+        bool onWorkerStart() override;
+
+        /**
+         * @brief Polls the source and queues its events.
+         */
+        void workerProcess() override;
+
+        /**
+         * @brief Sleeps until the source has events, it is time for an auto-repeat or the worker is stopped.
+         */
+        void workerWaitNextCycle() override;
+
+        /**
+         * @brief Logs the queue counters.
+         */
+        void onWorkerStop() override;
+    };
+
+    // Template & inline methods implementation
+
+    template<typename Consumer>
+    size_t InputWorker::drainEvents(Consumer&& consume) {
+        return queue_.drain(std::forward<Consumer>(consume));
+    }
+
+    inline uint64_t InputWorker::getDroppedEvents() const {
+        return queue_.getDroppedCount();
+    }
+
+} // namespace PiAlarm::input
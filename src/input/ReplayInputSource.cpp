@@ -0,0 +1,43 @@
+#include <algorithm>
+#include <utility>
+
+#include "ReplayInputSource.h"
+
+namespace PiAlarm::input {
+
+    ReplayInputSource::ReplayInputSource(std::vector<ScriptedInput> script)
+        : script_{std::move(script)}
+    {
+        std::ranges::stable_sort(script_, {}, &ScriptedInput::offset);
+    }
+
+    void ReplayInputSource::init() {
+        start_ = std::chrono::steady_clock::now();
+        nextInput_ = 0;
+    }
+
+    IInputSource::EventList ReplayInputSource::pollEvents() {
+        EventList events;
+        const auto now = std::chrono::steady_clock::now();
+
+        while (!isFinished()) {
+            const ScriptedInput& input = script_[nextInput_];
+            const TimePoint time = start_ + input.offset;
+            if (time > now) break;
+
+            events.push_back({input.button, input.pressed, time});
+            ++nextInput_;
+        }
+        return events;
+    }
+
+    std::vector<int> ReplayInputSource::getEventFds() const {
+        return {};
+    }
+
+    std::optional<IInputSource::TimePoint> ReplayInputSource::getNextEventTime() const {
+        if (isFinished()) return std::nullopt;
+        return start_ + script_[nextInput_].offset;
+    }
+
+} // namespace PiAlarm::input
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "IInputSource.h"
+#include "InputScript.h"
+
+namespace PiAlarm::input {
+
+    /**
+     * @class ReplayInputSource
+     * @brief Input source replaying a script of timed events, without any button.
+     *
+     * The script is played from the call to init(): each event is returned by the first poll made after its time,
+     * stamped with that time, as a GPIO event is stamped with the time of its edge. The latency measured
+     * from a replayed event therefore includes how late the loop polls it.
+     * The script is expected to contain the auto-repeats, as recorded by InputRecorder: none is generated.
+     */
+    class ReplayInputSource final : public IInputSource {
+        std::vector<ScriptedInput> script_; ///< The events to replay, sorted by time
+        size_t nextInput_ {0}; ///< Index of the next event to replay
+        TimePoint start_ {}; ///< Time the replay started at
+
+    public:
+
+        /**
+         * @brief Constructs a source replaying the given events.
+         * @param script The events, sorted by time if they are not.
+         */
+        explicit ReplayInputSource(std::vector<ScriptedInput> script);
+
+        /**
+         * @brief Starts the replay clock.
+         */
+        void init() override;
+
+        /**
+         * @brief Returns the events whose time has come.
+         * @return The events, stamped with the time they were scheduled at.
+         */
+        EventList pollEvents() override;
+
+        /**
+         * @brief No file descriptor signals the replayed events.
+         * @return An empty list.
+         */
+        [[nodiscard]]
+        std::vector<int> getEventFds() const override;
+
+        /**
+         * @brief Gets the time of the next event of the script.
+         * @return The time of the next event, empty once the script is over.
+         */
+        [[nodiscard]]
+        std::optional<TimePoint> getNextEventTime() const override;
+
+        /**
+         * @brief Checks if every event of the script was returned.
+         * @return True if the replay is over.
+         */
+        [[nodiscard]]
+        inline bool isFinished() const;
+    };
+
+    // Inline methods implementation
+
+    inline bool ReplayInputSource::isFinished() const {
+        return nextInput_ >= script_.size();
+    }
+
+} // namespace PiAlarm::input
@@ -27,13 +27,15 @@ int main(int argc, char *argv[]) {
     auto alarmCount = utils::getAlarmCount(argc, argv, 3);
     auto weatherCityName = utils::getWeatherLocation(argc, argv, "Brussel-1");
     auto customMusicFolderPath = utils::getMusicFolderPath(argc, argv, "");
+    auto inputRecordPath = utils::getInputRecordPath(argc, argv, "");
 
     Application app{
         static_cast<size_t>(alarmCount), // Number of alarms from command line arguments
         std::chrono::minutes(5), // Default snooze duration
         std::chrono::minutes(60), // Default ring duration
         weatherCityName, // Weather location from command line arguments
-        customMusicFolderPath // Custom music folder path from command line arguments
+        customMusicFolderPath, // Custom music folder path from command line arguments
+        inputRecordPath // Input record script from command line arguments
     };
     app.init();
     app.run();
@@ -1,8 +1,8 @@
 #pragma once
 
-#include <mutex>
+#include <cstdint>
 
-#include "BaseModelData.hpp"
+#include "SnapshotModelData.hpp"
 #include "common/Observable.hpp"
 
 namespace PiAlarm::model {
@@ -18,16 +18,36 @@ namespace PiAlarm::model {
         VeryPoor
     };
 
+    /**
+     * @struct CO2Values
+     * @brief Values measured by the CO2 sensor at the same time.
+     */
+    struct CO2Values {
+        uint16_t co2_ppm {0}; ///< CO2 concentration in ppm (parts per million)
+        bool valid {false};   ///< True if the values are valid, always check it before using them
+
+        /**
+         * @brief Gets the air quality level based on the CO2 concentration.
+         * The air quality level is determined as follows:
+         * - Good: CO2 < 800 ppm
+         * - Poor: 800 ppm <= CO2 < 1500 ppm
+         * - Very Poor: CO2 >= 1500 ppm
+         * @return The air quality level as an AirQualityLevel enum value.
+         */
+        [[nodiscard]]
+        inline AirQualityLevel getAirQualityLevel() const;
+
+        bool operator==(const CO2Values&) const = default;
+    };
+
     /**
      * @class CO2Data
      * @brief Represents the CO2 level data, including CO2 concentration and air quality level.
      *
      * This class extends the Observable class to notify observers of changes in the CO2 data.
+     * The values are published together: snapshot() reads all of them without waiting for the writer.
      */
-    class CO2Data final : public BaseModelData, public common::Observable {
-        uint16_t co2_ppm_;
-        bool valid_ = false;
-
+    class CO2Data final : public SnapshotModelData<CO2Values>, public common::Observable {
     public:
         /**
          * @brief Default constructor for CO2Data.
@@ -71,11 +91,8 @@ namespace PiAlarm::model {
 
         /**
          * @brief Gets the air quality level based on the current CO2 concentration.
-         * The air quality level is determined as follows:
-         * - Good: CO2 < 800 ppm
-         * - Poor: 800 ppm <= CO2 < 1500 ppm
-         * - Very Poor: CO2 >= 1500 ppm
          * @return The air quality level as an AirQualityLevel enum value.
+         * @see CO2Values::getAirQualityLevel() for the thresholds.
          * @note Always check if the CO2 data is valid before using this value.
          */
         [[nodiscard]]
@@ -92,24 +109,22 @@ namespace PiAlarm::model {
 
     // inline methods implementations
 
-    inline uint16_t CO2Data::getCO2() const {
-        std::lock_guard lock{mutex_};
+    inline AirQualityLevel CO2Values::getAirQualityLevel() const {
+        if (co2_ppm < 800) return AirQualityLevel::Good;
+        if (co2_ppm < 1500) return AirQualityLevel::Poor;
+        return AirQualityLevel::VeryPoor;
+    }
 
-        return co2_ppm_;
+    inline uint16_t CO2Data::getCO2() const {
+        return snapshot().co2_ppm;
     }
 
     inline AirQualityLevel CO2Data::getAirQualityLevel() const {
-        std::lock_guard lock{mutex_};
-
-        if (co2_ppm_ < 800) return AirQualityLevel::Good;
-        if (co2_ppm_ < 1500) return AirQualityLevel::Poor;
-        return AirQualityLevel::VeryPoor;
+        return snapshot().getAirQualityLevel();
     }
 
     inline bool CO2Data::isValid() const {
-        std::lock_guard lock{mutex_};
-
-        return valid_;
+        return snapshot().valid;
     }
 
 } // namespace PiAlarm::model
\ No newline at end of file
@@ -3,58 +3,44 @@
 namespace PiAlarm::model {
 
     CurrentIndoorData::CurrentIndoorData(float temperature, float humidity, float pressure, bool valid)
-        : temperature_{temperature}, humidity_{humidity}, pressure_{pressure}, valid_{valid}
+        : SnapshotModelData{{temperature, humidity, pressure, valid}}
     {}
 
     void CurrentIndoorData::setTemperature(float temperature) {
-        bool valueChanged = setIfDifferent(temperature_, temperature);
+        bool valueChanged = setIfDifferent(&IndoorValues::temperature, temperature);
 
         if (valueChanged) notifyObservers();
     }
 
     void CurrentIndoorData::setHumidity(float humidity) {
-        bool valueChanged = setIfDifferent(humidity_, humidity);
+        bool valueChanged = setIfDifferent(&IndoorValues::humidity, humidity);
 
         if (valueChanged) notifyObservers();
     }
 
     void CurrentIndoorData::setPressure(float pressure) {
-        bool valueChanged = setIfDifferent(pressure_, pressure);
+        bool valueChanged = setIfDifferent(&IndoorValues::pressure, pressure);
 
         if (valueChanged) notifyObservers();
     }
 
     void CurrentIndoorData::setValid(bool valid) {
-        bool valueChanged = setIfDifferent(valid_, valid);
+        bool valueChanged = setIfDifferent(&IndoorValues::valid, valid);
 
         if (valueChanged) notifyObservers();
     }
 
     void CurrentIndoorData::setValues(float temperature, float humidity, float pressure, bool valid) {
-        bool valueChanged = false;
-
-        {
-            std::lock_guard lock{mutex_};
-
-            const bool tempChanged = (temperature_ != temperature);
-            const bool humChanged = (humidity_ != humidity);
-            const bool pressChanged = (pressure_ != pressure);
-            const bool validChanged = (valid_ != valid);
-
-            const bool anyChange = tempChanged || humChanged || pressChanged || validChanged;
+        const IndoorValues newValues {temperature, humidity, pressure, valid};
 
+        const bool valueChanged = change([&newValues](IndoorValues& values) {
             // Only update if at least one state is valid
             // Prevents updating when both old and new states are invalid
-            const bool anyValid = valid_ || valid;
-
-            if (anyChange && anyValid) {
-                temperature_ = temperature;
-                humidity_ = humidity;
-                pressure_ = pressure;
-                valid_ = valid;
-                valueChanged = true;
-            }
-        }
+            if (values == newValues || !(values.valid || newValues.valid)) return false;
+
+            values = newValues;
+            return true;
+        });
 
         if (valueChanged) notifyObservers();
     }
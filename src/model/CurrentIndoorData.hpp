@@ -1,24 +1,32 @@
 #pragma once
 
-#include <mutex>
-
-#include "BaseModelData.hpp"
+#include "SnapshotModelData.hpp"
 #include "common/Observable.hpp"
 
 namespace PiAlarm::model {
 
+    /**
+     * @struct IndoorValues
+     * @brief Values measured by the indoor sensor at the same time.
+     */
+    struct IndoorValues {
+        float temperature {0}; ///< Temperature in °C
+        float humidity {0};    ///< Relative humidity in %
+        float pressure {0};    ///< Pressure in hPa
+        bool valid {false};    ///< True if the values are valid, always check it before using them
+
+        bool operator==(const IndoorValues&) const = default;
+    };
+
     /**
      * @class CurrentIndoorData
      * @brief Represents the data from a temperature sensor, including temperature, humidity, pressure, and validity status.
      *
      * This class extends the Observable class to notify observers of changes in the temperature sensor data.
+     * The values are published together: snapshot() reads all of them without waiting for the writer,
+     * and never mixes two measurements. Prefer it to the getters when several values are needed.
      */
-    class CurrentIndoorData final : public BaseModelData, public common::Observable {
-        float temperature_;
-        float humidity_;
-        float pressure_;
-        bool valid_ = false;
-
+    class CurrentIndoorData final : public SnapshotModelData<IndoorValues>, public common::Observable {
     public:
         /**
          * @brief Default constructor for CurrentIndoorData.
@@ -104,27 +112,19 @@ namespace PiAlarm::model {
     // inline methods implementations
 
     inline float CurrentIndoorData::getTemperature() const {
-        std::lock_guard lock{mutex_};
-
-        return temperature_;
+        return snapshot().temperature;
     }
 
     inline float CurrentIndoorData::getHumidity() const {
-        std::lock_guard lock{mutex_};
-
-        return humidity_;
+        return snapshot().humidity;
     }
 
     inline float CurrentIndoorData::getPressure() const {
-        std::lock_guard lock{mutex_};
-
-        return pressure_;
+        return snapshot().pressure;
     }
 
     inline bool CurrentIndoorData::isValid() const {
-        std::lock_guard lock{mutex_};
-
-        return valid_;
+        return snapshot().valid;
     }
 
 } // namespace PiAlarm::model
\ No newline at end of file
@@ -9,40 +9,35 @@ namespace PiAlarm::model {
         common::WeatherCondition condition,
         bool valid
         )
-        : BaseModelData{},
-        temperature_{temperature},
-        humidity_{humidity},
-        pressure_{pressure},
-        condition_{condition},
-        valid_{valid}
+        : SnapshotModelData{{temperature, humidity, pressure, condition, valid}}
         {}
 
     void CurrentWeatherData::setTemperature(float temperature) {
-        bool valueChanged = setIfDifferent(temperature_, temperature);
+        bool valueChanged = setIfDifferent(&WeatherValues::temperature, temperature);
 
         if (valueChanged) notifyObservers();
     }
 
     void CurrentWeatherData::setHumidity(float humidity) {
-        bool valueChanged = setIfDifferent(humidity_, humidity);
+        bool valueChanged = setIfDifferent(&WeatherValues::humidity, humidity);
 
         if (valueChanged) notifyObservers();
     }
 
     void CurrentWeatherData::setPressure(float pressure) {
-        bool valueChanged = setIfDifferent(pressure_, pressure);
+        bool valueChanged = setIfDifferent(&WeatherValues::pressure, pressure);
 
         if (valueChanged) notifyObservers();
     }
 
     void CurrentWeatherData::setCondition(common::WeatherCondition condition) {
-        bool valueChanged = setIfDifferent(condition_, condition);
+        bool valueChanged = setIfDifferent(&WeatherValues::condition, condition);
 
         if (valueChanged) notifyObservers();
     }
 
     void CurrentWeatherData::setValid(bool valid) {
-        bool valueChanged = setIfDifferent(valid_, valid);
+        bool valueChanged = setIfDifferent(&WeatherValues::valid, valid);
 
         if (valueChanged) notifyObservers();
     }
@@ -54,26 +49,14 @@ namespace PiAlarm::model {
         common::WeatherCondition condition,
         bool valid
     ) {
-        bool valueChanged {false};
-
-        {
-            std::lock_guard lock{mutex_};
-
-            const bool tempChanged = (temperature_ != temperature);
-            const bool humChanged = (humidity_ != humidity);
-            const bool pressChanged = (pressure_ != pressure);
-            const bool condChanged = (condition_ != condition);
-            const bool validChanged = (valid_ != valid);
-
-            if ((tempChanged || humChanged || pressChanged || condChanged || validChanged) && (valid_ || valid)) {
-                temperature_ = temperature;
-                humidity_ = humidity;
-                pressure_ = pressure;
-                condition_ = condition;
-                valid_ = valid;
-                valueChanged = true;
-            }
-        }
+        const WeatherValues newValues {temperature, humidity, pressure, condition, valid};
+
+        const bool valueChanged = change([&newValues](WeatherValues& values) {
+            if (values == newValues || !(values.valid || newValues.valid)) return false;
+
+            values = newValues;
+            return true;
+        });
 
         if (valueChanged) notifyObservers();
     }
@@ -1,24 +1,34 @@
 #pragma once
 
-#include "BaseModelData.hpp"
+#include "SnapshotModelData.hpp"
 #include "common/Observable.hpp"
 #include "common/WeatherCondition.h"
 
 namespace PiAlarm::model {
 
+    /**
+     * @struct WeatherValues
+     * @brief Values of the same weather report.
+     */
+    struct WeatherValues {
+        float temperature {0}; ///< Temperature in °C
+        float humidity {0};    ///< Relative humidity in %
+        float pressure {0};    ///< Pressure in hPa
+        common::WeatherCondition condition {common::WeatherCondition::Unknown}; ///< Weather condition
+        bool valid {false};    ///< True if the values are valid, always check it before using them
+
+        bool operator==(const WeatherValues&) const = default;
+    };
+
     /**
      * @class CurrentWeatherData
      * @brief Represents the current weather data including temperature, humidity, pressure, and condition.
      *
      * This class extends the Observable class to notify observers of changes in the weather data.
+     * The values are published together: snapshot() reads all of them without waiting for the writer,
+     * and never mixes two reports. Prefer it to the getters when several values are needed.
      */
-    class CurrentWeatherData final : public BaseModelData, public common::Observable {
-        float temperature_;
-        float humidity_;
-        float pressure_;
-        common::WeatherCondition condition_;
-        bool valid_ = false;
-
+    class CurrentWeatherData final : public SnapshotModelData<WeatherValues>, public common::Observable {
     public:
 
         /**
@@ -103,11 +113,11 @@ namespace PiAlarm::model {
 
         /**
          * Gets the current weather condition.
-         * @return A reference to the current weather condition.
+         * @return The current weather condition.
          * @note Always checks if the weather data is valid before using this value.
          */
         [[nodiscard]]
-        inline const common::WeatherCondition& getCondition() const;
+        inline common::WeatherCondition getCondition() const;
 
         /**
          * Checks if the weather data is valid.
@@ -120,33 +130,23 @@ namespace PiAlarm::model {
     // Inline method implementations
 
     inline float CurrentWeatherData::getTemperature() const {
-        std::lock_guard lock{mutex_};
-
-        return temperature_;
+        return snapshot().temperature;
     }
 
     inline float CurrentWeatherData::getHumidity() const {
-        std::lock_guard lock{mutex_};
-
-        return humidity_;
+        return snapshot().humidity;
     }
 
     inline float CurrentWeatherData::getPressure() const {
-        std::lock_guard lock{mutex_};
-
-        return pressure_;
+        return snapshot().pressure;
     }
 
-    inline const common::WeatherCondition& CurrentWeatherData::getCondition() const {
-        std::lock_guard lock{mutex_};
-
-        return condition_;
+    inline common::WeatherCondition CurrentWeatherData::getCondition() const {
+        return snapshot().condition;
     }
 
     inline bool CurrentWeatherData::isValid() const {
-        std::lock_guard lock{mutex_};
-
-        return valid_;
+        return snapshot().valid;
     }
 
 } // namespace PiAlarm::model
\ No newline at end of file
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <mutex>
+
+#include "BaseModelData.hpp"
+#include "common/SeqLock.hpp"
+
+namespace PiAlarm::model {
+
+    /**
+     * @class SnapshotModelData
+     * @brief Base class for model data whose values are read together.
+     *
+     * The values are grouped in a small struct. Writers change it under the mutex and publish every new version
+     * through a sequence lock, readers get a copy of the last version with snapshot(), without taking the mutex.
+     * All the values of a snapshot come from the same version, even when a writer changes several of them at once.
+     *
+     * @tparam T Type of the values, trivially copyable and comparable.
+     */
+    template<typename T>
+    class SnapshotModelData : public BaseModelData {
+        T values_; ///< Values being written, under the mutex
+        common::SeqLock<T> published_; ///< Last published values
+
+    public:
+
+        /**
+         * Gets a consistent copy of all the values.
+         * Never waits for the mutex, can be called by any thread.
+         * @return The last published values.
+         */
+        [[nodiscard]]
+        inline T snapshot() const;
+
+    protected:
+
+        /**
+         * Constructs the model with its initial values.
+         * @param values The initial values.
+         */
+        explicit SnapshotModelData(const T& values = T{})
+            : values_{values}, published_{values}
+        {}
+
+        /**
+         * Sets one of the values if it is different from the current one, and publishes the change.
+         * @param member Pointer to the member of the values to set.
+         * @param newValue The new value to set.
+         * @return True if the value was changed, false otherwise.
+         */
+        template<typename Member>
+        bool setIfDifferent(Member T::* member, const Member& newValue);
+
+        /**
+         * Changes the values with a function, and publishes them if the function reports a change.
+         * @param function Function called with the values to modify, returning true if it changed them.
+         * @return True if the values were changed, false otherwise.
+         */
+        template<typename Function>
+        bool change(Function function);
+    };
+
+    // Inline methods implementation
+
+    template<typename T>
+    inline T SnapshotModelData<T>::snapshot() const {
+        return published_.load();
+    }
+
+    // Template methods implementation
+
+    template<typename T>
+    template<typename Member>
+    bool SnapshotModelData<T>::setIfDifferent(Member T::* member, const Member& newValue) {
+        return change([&](T& values) {
+            if (values.*member == newValue) return false;
+
+            values.*member = newValue;
+            return true;
+        });
+    }
+
+    template<typename T>
+    template<typename Function>
+    bool SnapshotModelData<T>::change(Function function) {
+        std::lock_guard lock{mutex_};
+
+        if (!function(values_)) return false;
+
+        published_.store(values_);
+        return true;
+    }
+
+} // namespace PiAlarm::model
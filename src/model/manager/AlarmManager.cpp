@@ -9,7 +9,8 @@ namespace PiAlarm::model::manager {
         const ClockData& clockData,
         const AlarmsData& alarmsData,
         std::chrono::minutes snoozeDuration,
-        std::chrono::minutes ringDuration
+        std::chrono::minutes ringDuration,
+        common::Dispatcher* dispatcher
     )
         : clockData_{clockData},
         alarmsData_{alarmsData},
@@ -23,7 +24,7 @@ namespace PiAlarm::model::manager {
             throw std::invalid_argument("Ring duration must be greater than zero.");
         }
 
-        clockData_.addObserver(this);
+        clockData_.addObserver(this, dispatcher);
     }
 
     AlarmManager::~AlarmManager() {
@@ -3,6 +3,7 @@
 #include <chrono>
 #include <optional>
 
+#include "common/Dispatcher.h"
 #include "common/Observer.h"
 #include "model/ClockData.hpp"
 #include "model/Alarm.hpp"
@@ -44,6 +45,8 @@ namespace PiAlarm::model::manager {
          * @param alarmsData Reference to the alarms data model.
          * @param snoozeDuration The duration for which the alarm can be snoozed.
          * @param ringDuration The effective duration for which the alarm rings when triggered.
+         * @param dispatcher Dispatcher running the updates of the manager when the clock changes (e.g. on the UI thread),
+         * null to run them on the thread that sets the clock.
          * @throws std::invalid_argument if snoozeDuration is zero.
          * @throws std::invalid_argument if ringDuration is zero.
          */
@@ -51,7 +54,8 @@ namespace PiAlarm::model::manager {
             const ClockData& clockData,
             const AlarmsData& alarmsData,
             std::chrono::minutes snoozeDuration = std::chrono::minutes(5),
-            std::chrono::minutes ringDuration = std::chrono::minutes(60)
+            std::chrono::minutes ringDuration = std::chrono::minutes(60),
+            common::Dispatcher* dispatcher = nullptr
         );
 
         /**
@@ -5,9 +5,10 @@
 namespace PiAlarm::service {
 
     BME280Service::BME280Service(
+        CoroutineExecutor& executor,
         model::CurrentIndoorData& currentIndoorData
     )
-        : BaseService("BME280Service"),
+        : CoroutineService(executor, "BME280Service"),
           currentIndoorData_{currentIndoorData}
     {}
 
@@ -16,6 +17,11 @@ namespace PiAlarm::service {
             BME280_.initialize();
             measurementDelay_ = BME280_.getMeasurementDelay();
 
+            // process() awaits the measurement, its duration must not count as an overrun
+            if (const auto budget = common::CycleStats::getDefaultBudget(); budget > common::CycleStats::Duration::zero()) {
+                setCycleBudget(std::chrono::duration_cast<std::chrono::milliseconds>(budget) + measurementDelay_);
+            }
+
             return true;
         } catch (const std::exception& e) {
             logger().error("Failed to start BME280 sensor: {}", e.what());
@@ -23,11 +29,14 @@ namespace PiAlarm::service {
         }
     }
 
-    void BME280Service::process() {
+    Task BME280Service::process() {
         using hardware::BME280;
         try {
             BME280_.setMode(BME280::Mode::Forced);
-            std::this_thread::sleep_for(measurementDelay_);
+            const bool measured = co_await sleepFor(measurementDelay_); // not in the condition, GCC 12 miscompiles it
+            if (!measured) {
+                co_return; // stopped during the measurement
+            }
 
             const auto measurement = BME280_.readMeasurement();
 
@@ -2,7 +2,7 @@
 
 #ifdef SENSOR_BME280
 
-#include "BaseService.h"
+#include "CoroutineService.h"
 #include "hardware/BME280.h"
 #include "model/CurrentIndoorData.hpp"
 
@@ -12,7 +12,7 @@ namespace PiAlarm::service {
      * @class BME280Service
      * @brief Service for fetching and updating indoor environmental data from the BME280 sensor.
      */
-    class BME280Service : public BaseService {
+    class BME280Service : public CoroutineService {
         hardware::BME280 BME280_; ///< BME280 sensor for indoor measurements.
         model::CurrentIndoorData& currentIndoorData_; ///< Reference to the CurrentIndoorData model to be updated with sensor readings.
         std::chrono::milliseconds measurementDelay_ {50}; ///< Delay required by the BME280 sensor between measurements. Set to 50 by default, but updated after the initialization of the sensor.
@@ -23,9 +23,10 @@ namespace PiAlarm::service {
     public:
         /**
          * @brief Constructs a CurrentIndoorService that updates the CurrentIndoorData model with indoor sensor data.
+         * @param executor The executor running the service.
          * @param currentIndoorData Reference to the CurrentIndoorData model to be updated with sensor readings.
          */
-        explicit BME280Service(model::CurrentIndoorData& currentIndoorData);
+        BME280Service(CoroutineExecutor& executor, model::CurrentIndoorData& currentIndoorData);
 
     protected:
         /**
@@ -37,7 +38,7 @@ namespace PiAlarm::service {
         /**
          * @brief Updates the data in the CurrentIndoorData model.
          */
-        void process() override;
+        Task process() override;
 
         /**
          * @brief Returns the update interval for the service.
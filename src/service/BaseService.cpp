@@ -0,0 +1,134 @@
+#include "BaseService.h"
+
+namespace PiAlarm::service {
+
+    BaseService::BaseService(ServiceScheduler& scheduler, const std::string& serviceName)
+        : HasLogger{serviceName}, scheduler_{scheduler}, stats_{serviceName}
+    {}
+
+    BaseService::~BaseService() {
+        scheduler_.remove(*this); // the scheduler must not keep a pointer to a destroyed service
+    }
+
+    void BaseService::start() {
+        if (running_) return;
+
+        running_ = true;
+        paused_ = false;
+        scheduler_.add(*this);
+
+        logger().info("Service started");
+    }
+
+    void BaseService::stop() {
+        const bool previouslyRunning = running_.exchange(false);
+
+        if (cycleThread_.load() == std::this_thread::get_id()) {
+            // Called by the service from its own cycle, which cannot be waited for
+            scheduler_.remove(*this, false);
+            stoppedInCycle_ = true;
+        } else {
+            scheduler_.remove(*this); // no cycle runs once it returns
+
+            if (started_) {
+                executeStop();
+                started_ = false;
+            }
+        }
+        paused_ = false;
+
+        if (previouslyRunning) {
+            logger().info("Service stopped");
+        } else {
+            logger().info("Service was already stopped");
+        }
+    }
+
+    void BaseService::pause() {
+        if (running_) {
+            scheduler_.pause(*this);
+        }
+
+        logger().info("Service paused");
+    }
+
+    void BaseService::resume() {
+        scheduler_.resume(*this);
+
+        logger().info("Service resumed");
+    }
+
+    void BaseService::scheduleNextCycleIn(std::chrono::milliseconds delay) {
+        nextCycle_ = ServiceScheduler::Clock::now() + delay;
+    }
+
+    void BaseService::scheduleNextCycleAt(std::chrono::system_clock::time_point time_point) {
+        nextCycle_ = ServiceScheduler::Clock::now() + (time_point - std::chrono::system_clock::now());
+    }
+
+    bool BaseService::executeCycle() {
+        if (!started_) {
+            if (!executeStart()) {
+                running_ = false;
+                return false;
+            }
+            started_ = true;
+        }
+
+        cycleThread_ = std::this_thread::get_id();
+        try {
+            const auto processStart = ServiceScheduler::Clock::now();
+            nextCycle_ = processStart; // if waitNextCycle() schedules nothing
+            process();
+
+            stats_.recordProcess(ServiceScheduler::Clock::now() - processStart, logger());
+
+            waitNextCycle();
+        }
+        catch (...) {
+            stats_.recordException(logger());
+            scheduleNextCycleIn(std::chrono::milliseconds{500});
+        }
+        cycleThread_ = std::thread::id{};
+
+        if (stoppedInCycle_) {
+            // stop() was called from the cycle, the scheduler already forgot the service
+            stoppedInCycle_ = false;
+            executeStop();
+            started_ = false;
+        }
+
+        return true;
+    }
+
+    bool BaseService::executeStart() {
+        try {
+            if (!onStart()) {
+                logger().error("Service initialization failed. Stopping service.");
+                return false;
+            }
+            return true;
+        }
+        catch (const std::exception& e) {
+            logger().critical("Fatal exception during onStart: " + std::string(e.what()));
+            return false;
+        }
+        catch (...) {
+            logger().critical("Unknown fatal exception during onStart.");
+            return false;
+        }
+    }
+
+    void BaseService::executeStop() {
+        try {
+            onStop();
+        }
+        catch (const std::exception& e) {
+            logger().error("Exception caught during onStop: " + std::string(e.what()));
+        }
+        catch (...) {
+            logger().error("Unknown exception caught during onStop.");
+        }
+    }
+
+} // namespace PiAlarm::service
@@ -1,7 +1,15 @@
 #pragma once
 
+#include <atomic>
+#include <chrono>
+#include <optional>
+#include <string>
+#include <thread>
+
+#include "common/CycleStats.h"
 #include "IService.h"
-#include "common/HasWorker.h"
+#include "ServiceScheduler.h"
+#include "logging/HasLogger.h"
 
 namespace PiAlarm::service {
 
@@ -9,22 +17,55 @@ namespace PiAlarm::service {
      * @class BaseService
      * @brief Abstract base class for services in the PiAlarm application.
      *
-     * This class adapts the lower-level thread management provided by common::HasWorker
-     * to the service architecture defined by IService.
+     * This class runs the cycles of a service (process() then waitNextCycle()) on the shared ServiceScheduler,
+     * behind the service architecture defined by IService. A service does not own a thread:
+     * waitNextCycle() does not block, it tells the scheduler when the next cycle is due.
+     * Each cycle is timed in the CycleStats of the service: a process() longer than the cycle budget is logged.
      */
-    class BaseService : public IService, protected common::HasWorker {
+    class BaseService : public IService, protected logging::HasLogger {
+        friend class ServiceScheduler; // runs the cycles and owns the scheduling state
+
+        ServiceScheduler& scheduler_; ///< Scheduler running the cycles of the service
+
+        std::atomic<bool> running_ {false}; ///< Indicates if the service is currently running
+        std::atomic<bool> paused_ {false}; ///< Indicates if the service is currently paused
+
+        // Scheduling state, guarded by the mutex of the scheduler
+        bool scheduled_ {false}; ///< Whether the service is known by the scheduler (ready, waiting, running or parked)
+        bool inCycle_ {false}; ///< Whether a cycle is running
+        bool parked_ {false}; ///< Whether a cycle came due while paused, to run on resume
+        std::optional<ServiceScheduler::Clock::duration> lastCycleDuration_ {}; ///< Duration of the last cycle, empty before the first one
+        std::optional<ServiceScheduler::TimePoint> dueCycle_ {}; ///< Time the next cycle is due, empty if it does not come from the timers
+        ServiceScheduler::TimePoint lastCycleEnd_ {}; ///< Time the last cycle ended
+
+        // Cycle state, only used by the thread running the cycle
+        std::atomic<std::thread::id> cycleThread_ {}; ///< Thread running the cycle, to detect a stop() called from the cycle
+        bool stoppedInCycle_ {false}; ///< Whether stop() was called from the cycle, which then calls onStop() once done
+        bool started_ {false}; ///< Whether onStart() succeeded, so onStop() must be called
+        ServiceScheduler::TimePoint nextCycle_ {}; ///< Time of the next cycle, set by waitNextCycle()
+
+        common::CycleStats stats_; ///< Timing of the cycles of the service
+
     public:
         /**
          * @brief Constructor for BaseService.
          *
          * Initializes the service with a given name and sets the initial state to not running and not paused.
+         * @param scheduler The scheduler running the cycles of the service, it must outlive the service.
          * @param serviceName The name of the service.
          */
-        explicit BaseService(const std::string& serviceName) : HasWorker{serviceName} {}
+        BaseService(ServiceScheduler& scheduler, const std::string& serviceName);
+
+        /**
+         * @brief Destructor for BaseService.
+         *
+         * Removes the service from the scheduler if it is running.
+         */
+        ~BaseService() override;
 
     protected:
         /**
-         * @brief Method called in the worker thread just before entering the main loop.
+         * @brief Method called before the first cycle of the service.
          * Derived classes can override this to perform specific initialization (e.g., hardware setup).
          * If it returns false, the service will stop immediately.
          * @return true if initialization succeeded, false otherwise.
@@ -32,7 +73,7 @@ namespace PiAlarm::service {
         virtual bool onStart() { return true; }
 
         /**
-         * @brief Method called just before the service loop terminates.
+         * @brief Method called when the service is stopped, if onStart() succeeded.
          * Derived classes can override this to release resources or put hardware to sleep.
          */
         virtual void onStop() {}
@@ -40,26 +81,25 @@ namespace PiAlarm::service {
         /**
          * @brief Method to be implemented by derived classes for service-specific functionality.
          *
-         * This method is called in the worker thread and should contain the main logic of the service.
-         * It is called repeatedly until the service is stopped.
+         * This method is called by a thread of the scheduler and should contain the main logic of the service.
+         * It is called repeatedly until the service is stopped, never by two threads at once.
          */
         virtual void process() = 0;
 
         /**
-         * @brief Waits before the next update cycle.
+         * @brief Schedules the next update cycle.
          *
          * This method is called after each call to process() and is responsible for introducing a delay
-         * between cycles. The default implementation delegates to HasWorker::workerWaitNextCycle(), which uses
-         * interruptibleSleepFor with the value returned by updateInterval(). Derived classes may override this
-         * method to implement more precise or adaptive waiting strategies, such as using interruptibleSleepUntil()
-         * or event-based synchronization.
+         * between cycles. The default implementation uses scheduleNextCycleIn() with the value returned
+         * by updateInterval(). Derived classes may override this method to implement more precise or adaptive
+         * timing, such as using scheduleNextCycleAt().
          *
          * @note Override this method if you require custom control over the timing between update cycles.
-         * @warning Please use the given methods interruptibleSleepFor() or interruptibleSleepUntil()
-         * to ensure that the service can be stopped gracefully during the wait.
+         * @warning This method must not block: it holds a thread of the scheduler shared by every service.
+         * If it schedules nothing, the next cycle runs at once.
          */
         virtual void waitNextCycle() {
-            HasWorker::workerWaitNextCycle();
+            scheduleNextCycleIn(updateInterval());
         }
 
         /**
@@ -68,7 +108,7 @@ namespace PiAlarm::service {
          * This method provides a fixed time interval used by the default implementation of waitNextCycle().
          * Derived classes may override this method to specify a different process frequency.
          *
-         * @note Override this method only if you are using the default sleep_for-based waitNextCycle().
+         * @note Override this method only if you are using the default waitNextCycle().
          *
          * @warning If you override waitNextCycle(), this value may not be used.
          *
@@ -80,41 +120,34 @@ namespace PiAlarm::service {
         }
 
         /**
-         * @brief Performs an interruptible sleep for a specified duration.
-         *
-         * This method uses the internal condition variable to wait, allowing the wait
-         * to be interrupted if the service is stopped.
-         * @param duration The duration to wait for.
-         * @return true if the wait completed (duration elapsed or notified), false if the service was stopped.
+         * @brief Schedules the next cycle after a delay, counted from now.
+         * @param delay The delay before the next cycle.
          */
-        using HasWorker::interruptibleSleepFor;
+        void scheduleNextCycleIn(std::chrono::milliseconds delay);
 
         /**
-         * @brief Performs an interruptible sleep until a specified time point.
-         *
-         * This method uses the internal condition variable to wait, allowing the wait
-         * to be interrupted if the service is stopped.
-         * @param time_point The time point to wait until.
-         * @return true if the wait completed (time point reached or notified), false if the service was stopped.
+         * @brief Schedules the next cycle at a time of the wall clock.
+         * @param time_point The time of the next cycle, converted to the steady clock of the scheduler when called.
          */
-        using HasWorker::interruptibleSleepUntil;
+        void scheduleNextCycleAt(std::chrono::system_clock::time_point time_point);
 
     public:
         /**
          * @brief Starts the service.
          *
-         * This method begins the service's operation in a separate thread.
+         * This method hands the service over to the scheduler, which runs its first cycle as soon as possible.
          * If the service is already running, this method does nothing.
          */
-        void start() override { startWorker(); }
+        void start() override;
 
         /**
          * @brief Stops the service.
          *
-         * This method stops the service and joins the worker thread.
+         * This method removes the service from the scheduler, waiting for a running cycle to end,
+         * then calls onStop(). Called from a cycle of the service, onStop() is called once that cycle returns.
          * If the service is not running, this method does nothing.
          */
-        void stop() override { stopWorker(); }
+        void stop() override;
 
         /**
          * @brief Pauses the service.
@@ -122,7 +155,7 @@ namespace PiAlarm::service {
          * This method pauses the service's operation. The service can be resumed later.
          * If the service is not running, this method does nothing.
          */
-        void pause() override { pauseWorker(); }
+        void pause() override;
 
         /**
          * @brief Resumes the service.
@@ -130,50 +163,54 @@ namespace PiAlarm::service {
          * This method resumes the service's operation if it is paused.
          * If the service is not running, this method does nothing.
          */
-        void resume() override { resumeWorker(); }
+        void resume() override;
 
         /**
          * @brief Checks if the service is currently running.
          * @return true if the service is running, false otherwise.
          */
         [[nodiscard]]
-        bool isRunning() const override { return isWorkerRunning(); }
+        bool isRunning() const override { return running_.load(); }
 
         /**
          * @brief Checks if the service is currently paused.
          * @return true if the service is paused, false otherwise.
          */
         [[nodiscard]]
-        bool isPaused() const override { return isWorkerPaused(); }
+        bool isPaused() const override { return paused_.load(); }
 
-    private:
         /**
-         * @brief Bridges HasWorker initialization to BaseService::onStart().
-         * @return true if initialization succeeded, false otherwise.
+         * @brief Gets the timing of the cycles of the service.
+         * @return The stats, which can be read while the service runs.
          */
-        bool onWorkerStart() final { return onStart(); }
+        [[nodiscard]]
+        const common::CycleStats& getCycleStats() const { return stats_; }
 
         /**
-         * @brief Bridges HasWorker cleanup to BaseService::onStop().
+         * @brief Sets the longest process() that is not logged as an overrun.
+         * @param budget The budget, zero to disable the check.
          */
-        void onWorkerStop() final { onStop(); }
+        void setCycleBudget(std::chrono::milliseconds budget) { stats_.setBudget(budget); }
 
+    private:
         /**
-         * @brief Bridges HasWorker process execution to BaseService::process().
+         * @brief Runs one cycle: onStart() the first time, process() and waitNextCycle().
+         *
+         * Exceptions are caught and logged, the cycle is then retried after a short delay.
+         * @return true if the service keeps running, false if onStart() failed.
          */
-        void workerProcess() final { process(); }
+        bool executeCycle();
 
         /**
-         * @brief Bridges HasWorker cycle waiting to BaseService::waitNextCycle().
+         * @brief Calls onStart() safely, intercepting all potential exceptions.
+         * @return true if initialization succeeded, false otherwise.
          */
-        void workerWaitNextCycle() final { waitNextCycle(); }
+        bool executeStart();
 
         /**
-         * @brief Bridges HasWorker update interval retrieval to BaseService::updateInterval().
-         * @return The duration interval between worker cycles.
+         * @brief Calls onStop() safely, intercepting all potential exceptions.
          */
-        [[nodiscard]]
-        std::chrono::milliseconds workerUpdateInterval() const final { return updateInterval(); }
+        void executeStop();
     };
 
-} // namespace PiAlarm::service
\ No newline at end of file
+} // namespace PiAlarm::service
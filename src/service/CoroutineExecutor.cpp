@@ -0,0 +1,261 @@
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+#ifdef __linux__
+    #include <sys/epoll.h>
+    #include <sys/eventfd.h>
+    #include <sys/timerfd.h>
+    #include <ctime>
+    #include <unistd.h>
+#endif
+
+#include "CoroutineExecutor.h"
+
+namespace PiAlarm::service {
+
+    CoroutineExecutor::CoroutineExecutor()
+        : HasWorker{"CoroutineExecutor"}, epoch_{Clock::now()}
+    {
+        setWorkerCycleBudget(std::chrono::milliseconds::zero()); // workerProcess() mostly waits, each service times its own cycles
+
+        #ifdef __linux__
+            epollFd_ = epoll_create1(EPOLL_CLOEXEC);
+            notifyFd_ = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+            timerFd_ = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC); // the clock of std::chrono::steady_clock
+
+            if (epollFd_ < 0 || notifyFd_ < 0 || timerFd_ < 0) {
+                const std::string error {std::strerror(errno)};
+                closeAll();
+                throw std::runtime_error("Unable to create the executor file descriptors : " + error);
+            }
+
+            // Own file descriptors are told apart from the waiters by their address
+            for (int* fd : {&notifyFd_, &timerFd_}) {
+                epoll_event event {};
+                event.events = EPOLLIN;
+                event.data.ptr = fd;
+
+                if (epoll_ctl(epollFd_, EPOLL_CTL_ADD, *fd, &event) < 0) {
+                    const std::string error {std::strerror(errno)};
+                    closeAll();
+                    throw std::runtime_error("Unable to watch the executor file descriptors : " + error);
+                }
+            }
+        #endif // __linux__
+    }
+
+    CoroutineExecutor::~CoroutineExecutor() {
+        stop(); // before the file descriptors are closed
+
+        #ifdef __linux__
+            closeAll();
+        #endif
+    }
+
+    void CoroutineExecutor::post(std::function<void()> callback) {
+        {
+            std::lock_guard lock{postMutex_};
+            posted_.push_back(std::move(callback));
+        }
+
+        #ifdef __linux__
+            const uint64_t one {1};
+            // it can only fail if the counter overflows, the executor is woken up anyway
+            [[maybe_unused]] auto written = ::write(notifyFd_, &one, sizeof(one));
+        #else
+            postedCv_.notify_one();
+        #endif
+    }
+
+    void CoroutineExecutor::stop() {
+        if (!isWorkerRunning()) return;
+
+        stopping_ = true;
+        post([] {}); // leave the wait
+
+        stopWorker();
+    }
+
+    void CoroutineExecutor::addTimer(TimePoint time, Waiter& waiter) {
+        const auto elapsed = std::chrono::ceil<std::chrono::milliseconds>(time - epoch_);
+        const auto tick = static_cast<Wheel::Tick>(std::max<std::chrono::milliseconds::rep>(elapsed / TICK, 0));
+
+        timers_.schedule(tick, &waiter);
+    }
+
+    void CoroutineExecutor::addReader([[maybe_unused]] int fd, Waiter& waiter) {
+        #ifdef __linux__
+            epoll_event event {};
+            event.events = EPOLLIN;
+            event.data.ptr = &waiter;
+
+            if (epoll_ctl(epollFd_, EPOLL_CTL_ADD, fd, &event) < 0) {
+                throw std::runtime_error("Unable to wait for file descriptor " + std::to_string(fd) + " : " + std::strerror(errno));
+            }
+
+            waiter.fd = fd;
+            readers_.push_back(&waiter);
+        #else
+            throw std::runtime_error("Waiting for a file descriptor is only supported on Linux");
+        #endif
+    }
+
+    std::vector<CoroutineExecutor::Waiter*> CoroutineExecutor::cancel(const void* owner) {
+        std::vector<Waiter*> cancelled;
+
+        timers_.cancelIf([&](Waiter* waiter) {
+            if (waiter->owner != owner) return false;
+            cancelled.push_back(waiter);
+            return true;
+        });
+
+        std::erase_if(readers_, [&](Waiter* waiter) {
+            if (waiter->owner != owner) return false;
+
+            #ifdef __linux__
+                epoll_ctl(epollFd_, EPOLL_CTL_DEL, waiter->fd, nullptr);
+            #endif
+            cancelled.push_back(waiter);
+            return true;
+        });
+
+        return cancelled;
+    }
+
+    bool CoroutineExecutor::onWorkerStart() {
+        stopping_ = false;
+        threadId_ = std::this_thread::get_id();
+        return true;
+    }
+
+    void CoroutineExecutor::onWorkerStop() {
+        threadId_ = std::thread::id{};
+    }
+
+#ifdef __linux__
+
+    void CoroutineExecutor::workerProcess() {
+        if (stopping_) return; // the wake-up of stop() may already be consumed, wait for the worker to stop
+        armTimer();
+
+        std::array<epoll_event, MAX_EVENTS> events {};
+        const int count = epoll_wait(epollFd_, events.data(), MAX_EVENTS, -1);
+        if (count < 0) {
+            if (errno == EINTR) return; // interrupted by a signal
+            throw std::runtime_error("Error waiting for events : " + std::string(std::strerror(errno)));
+        }
+
+        for (int i {0}; i < count && !stopping_; ++i) {
+            void* source = events[i].data.ptr;
+            uint64_t counter {0};
+
+            if (source == &notifyFd_) {
+                [[maybe_unused]] auto readBytes = ::read(notifyFd_, &counter, sizeof(counter)); // reset the counter
+                runPosted();
+            } else if (source == &timerFd_) {
+                [[maybe_unused]] auto readBytes = ::read(timerFd_, &counter, sizeof(counter));
+                armedTick_.reset(); // expired
+                runTimers();
+            } else {
+                runReader(static_cast<Waiter*>(source));
+            }
+        }
+    }
+
+    void CoroutineExecutor::armTimer() {
+        const auto nextTick = timers_.getNextTick();
+        if (nextTick == armedTick_) return;
+
+        itimerspec spec {}; // zero disarms the timer
+        if (nextTick) {
+            // A time already passed expires the timer at once
+            const auto time = toTime(*nextTick).time_since_epoch();
+            const auto seconds = std::chrono::duration_cast<std::chrono::seconds>(time);
+
+            spec.it_value.tv_sec = static_cast<time_t>(seconds.count());
+            spec.it_value.tv_nsec = static_cast<long>(std::chrono::duration_cast<std::chrono::nanoseconds>(time - seconds).count());
+        }
+
+        if (timerfd_settime(timerFd_, TFD_TIMER_ABSTIME, &spec, nullptr) < 0) {
+            throw std::runtime_error("Unable to set the executor timer : " + std::string(std::strerror(errno)));
+        }
+        armedTick_ = nextTick;
+    }
+
+    void CoroutineExecutor::closeAll() {
+        for (int* fd : {&epollFd_, &notifyFd_, &timerFd_}) {
+            if (*fd >= 0) ::close(*fd);
+            *fd = -1;
+        }
+    }
+
+#else // __linux__
+
+    void CoroutineExecutor::workerProcess() {
+        std::unique_lock lock{postMutex_};
+        auto ready = [this] { return !posted_.empty() || stopping_; };
+
+        if (const auto nextTick = timers_.getNextTick()) {
+            postedCv_.wait_until(lock, toTime(*nextTick), ready);
+        } else {
+            postedCv_.wait(lock, ready);
+        }
+        lock.unlock();
+
+        if (stopping_) return;
+        runPosted();
+        runTimers();
+    }
+
+#endif // __linux__
+
+    void CoroutineExecutor::runPosted() {
+        {
+            std::lock_guard lock{postMutex_};
+            running_.swap(posted_);
+        }
+
+        for (auto& callback : running_) {
+            callback();
+        }
+        running_.clear();
+    }
+
+    void CoroutineExecutor::runTimers() {
+        timers_.advance(nowTick(), expired_);
+
+        // A resumed coroutine can add timers to the wheel, not to the expired ones
+        for (Waiter* waiter : expired_) {
+            waiter->handle.resume();
+        }
+        expired_.clear();
+    }
+
+    void CoroutineExecutor::runReader(Waiter* waiter) {
+        // It may have been cancelled by a coroutine resumed by a previous event of the same wait
+        const auto it = std::ranges::find(readers_, waiter);
+        if (it == readers_.end()) return;
+
+        readers_.erase(it);
+        #ifdef __linux__
+            epoll_ctl(epollFd_, EPOLL_CTL_DEL, waiter->fd, nullptr);
+        #endif
+
+        waiter->handle.resume();
+    }
+
+    CoroutineExecutor::Wheel::Tick CoroutineExecutor::nowTick() const {
+        const auto elapsed = std::chrono::floor<std::chrono::milliseconds>(Clock::now() - epoch_);
+        return static_cast<Wheel::Tick>(std::max<std::chrono::milliseconds::rep>(elapsed / TICK, 0));
+    }
+
+    CoroutineExecutor::TimePoint CoroutineExecutor::toTime(Wheel::Tick tick) const {
+        return epoch_ + TICK * static_cast<std::chrono::milliseconds::rep>(tick);
+    }
+
+} // namespace PiAlarm::service
@@ -0,0 +1,220 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <coroutine>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+#ifndef __linux__
+    #include <condition_variable>
+#endif
+
+#include "common/HasWorker.h"
+#include "common/TimerWheel.hpp"
+
+namespace PiAlarm::service {
+
+    /**
+     * @class CoroutineExecutor
+     * @brief Runs the coroutines of the CoroutineService instances on a single thread.
+     *
+     * A suspended coroutine waits for a timer, a readable file descriptor or a callback posted from another thread
+     * (e.g. a model change). The thread sleeps in a single epoll_wait on all of them: the timers are kept in a
+     * timer wheel, whose next slot arms a timerfd on the steady clock, so a timer wakes the thread up at the start
+     * of its tick, without polling nor rounding the wait. The posted callbacks are signaled through an eventfd.
+     *
+     * Elsewhere than Linux, a condition variable is used and file descriptors cannot be waited for.
+     */
+    class CoroutineExecutor final : public common::HasWorker {
+    public:
+        using Clock = std::chrono::steady_clock; ///< Clock the timers run on
+        using TimePoint = Clock::time_point; ///< Alias for the time of a timer
+
+        static constexpr std::chrono::milliseconds TICK {1}; ///< Resolution of the timers
+
+        /**
+         * @struct Waiter
+         * @brief A suspended coroutine and what it waits for, living in the coroutine frame while it waits.
+         */
+        struct Waiter {
+            std::coroutine_handle<> handle {}; ///< Coroutine to resume
+            const void* owner {nullptr}; ///< Service the coroutine belongs to, to cancel its waits
+            int fd {-1}; ///< File descriptor waited for, -1 if none
+            bool cancelled {false}; ///< Whether the wait was cancelled instead of completed
+        };
+
+    private:
+        using Wheel = common::TimerWheel<Waiter*>; ///< Alias for the timer wheel type
+
+        const TimePoint epoch_; ///< Time of the tick 0 of the wheel
+
+#ifdef __linux__
+        static constexpr int MAX_EVENTS {16}; ///< Maximum number of ready file descriptors handled per wake up
+
+        int epollFd_ {-1}; ///< The epoll instance waiting on every source
+        int timerFd_ {-1}; ///< Timer armed on the next slot of the wheel
+        int notifyFd_ {-1}; ///< Event counter written when a callback is posted
+        std::optional<Wheel::Tick> armedTick_ {}; ///< Tick the timer is armed on, empty if disarmed
+#else
+        std::condition_variable postedCv_; ///< Signaled when a callback is posted
+#endif
+
+        std::mutex postMutex_; ///< Mutex guarding posted_
+        std::vector<std::function<void()>> posted_; ///< Callbacks to run on the executor thread
+        std::vector<std::function<void()>> running_; ///< Buffer of the callbacks being run
+
+        Wheel timers_; ///< Timers of the waiting coroutines, used by the executor thread only
+        std::vector<Waiter*> expired_; ///< Buffer for the expired timers
+        std::vector<Waiter*> readers_; ///< Coroutines waiting for a file descriptor, used by the executor thread only
+
+        std::atomic<bool> stopping_ {false}; ///< Whether stop() was called
+        std::atomic<std::thread::id> threadId_ {}; ///< Id of the executor thread while it runs
+
+    public:
+
+        /**
+         * @brief Creates the executor, its thread is started with startWorker().
+         * @throws std::runtime_error if a file descriptor cannot be created.
+         */
+        CoroutineExecutor();
+
+        /**
+         * @brief Stops the executor thread and closes the file descriptors.
+         */
+        ~CoroutineExecutor() override;
+
+        CoroutineExecutor(const CoroutineExecutor&) = delete; ///< No copy constructor
+        CoroutineExecutor& operator=(const CoroutineExecutor&) = delete; ///< No copy assignment operator
+
+        /**
+         * @brief Runs a callback on the executor thread, as soon as possible. Can be called from any thread.
+         * @param callback The callback.
+         */
+        void post(std::function<void()> callback);
+
+        /**
+         * @brief Starts the executor thread. If it is already running, this method does nothing.
+         */
+        void start() { startWorker(); }
+
+        /**
+         * @brief Stops the executor thread without waiting for the next timer.
+         * The coroutines stay suspended, their posted callbacks run once the executor is started again.
+         */
+        void stop();
+
+        /**
+         * @brief Checks if the caller runs on the executor thread.
+         * @return True if called from the executor thread.
+         */
+        [[nodiscard]]
+        inline bool isExecutorThread() const;
+
+        // Methods below are called from the executor thread only, or while it is stopped
+
+        /**
+         * @brief Resumes a coroutine once a time is reached.
+         * @param time The time to resume at.
+         * @param waiter The waiting coroutine, kept until resumed or cancelled.
+         */
+        void addTimer(TimePoint time, Waiter& waiter);
+
+        /**
+         * @brief Resumes a coroutine once a file descriptor is readable.
+         * @param fd The file descriptor, it must stay open while waited for.
+         * @param waiter The waiting coroutine, kept until resumed or cancelled.
+         * @throws std::runtime_error if the file descriptor cannot be waited for.
+         */
+        void addReader(int fd, Waiter& waiter);
+
+        /**
+         * @brief Removes the timers and file descriptors waited for by the coroutines of an owner.
+         * The coroutines are not resumed.
+         * @param owner The owner of the waiters.
+         * @return The removed waiters.
+         */
+        std::vector<Waiter*> cancel(const void* owner);
+
+    protected:
+
+        /**
+         * @brief Records the executor thread.
+         * @return Always true.
+         */
+        bool onWorkerStart() override;
+
+        /**
+         * @brief Waits for a timer, a file descriptor or a posted callback, and resumes what is ready.
+         */
+        void workerProcess() override;
+
+        /**
+         * @brief Does not wait, workerProcess() already waits.
+         */
+        void workerWaitNextCycle() override {}
+
+        /**
+         * @brief Forgets the executor thread.
+         */
+        void onWorkerStop() override;
+
+    private:
+
+        /**
+         * @brief Runs the callbacks posted so far.
+         */
+        void runPosted();
+
+        /**
+         * @brief Resumes the coroutines whose timer expired.
+         */
+        void runTimers();
+
+        /**
+         * @brief Resumes the coroutine waiting for a file descriptor, if it still waits.
+         * @param waiter The waiter given to epoll.
+         */
+        void runReader(Waiter* waiter);
+
+        /**
+         * @brief Gets the last tick started at the current time.
+         * @return The tick, rounded down.
+         */
+        [[nodiscard]]
+        Wheel::Tick nowTick() const;
+
+        /**
+         * @brief Converts a tick of the wheel to a time.
+         * @param tick The tick to convert.
+         * @return The time the tick starts at.
+         */
+        [[nodiscard]]
+        TimePoint toTime(Wheel::Tick tick) const;
+
+#ifdef __linux__
+
+        /**
+         * @brief Arms the timer on the next slot of the wheel, or disarms it if the wheel is empty.
+         * @throws std::runtime_error if the timer cannot be set.
+         */
+        void armTimer();
+
+        /**
+         * @brief Closes the file descriptors opened by the executor.
+         */
+        void closeAll();
+
+#endif // __linux__
+    };
+
+    // Inline methods implementation
+
+    inline bool CoroutineExecutor::isExecutorThread() const {
+        return threadId_.load() == std::this_thread::get_id();
+    }
+
+} // namespace PiAlarm::service
@@ -0,0 +1,233 @@
+#include <future>
+
+#include "CoroutineService.h"
+
+namespace PiAlarm::service {
+
+    void ServiceSignal::fire() {
+        if (waiter_) {
+            std::exchange(waiter_, nullptr)->handle.resume();
+        } else {
+            pending_ = true;
+        }
+    }
+
+    ModelSignal::ModelSignal(CoroutineExecutor& executor, const common::Observable& model)
+        : executor_{executor}, model_{model}
+    {
+        model_.addObserver(this);
+    }
+
+    ModelSignal::~ModelSignal() {
+        model_.removeObserver(this);
+    }
+
+    void ModelSignal::update() {
+        executor_.post([this] { fire(); });
+    }
+
+    CoroutineService::CoroutineService(CoroutineExecutor& executor, const std::string& serviceName)
+        : HasLogger{serviceName}, executor_{executor}, stats_{serviceName}
+    {}
+
+    CoroutineService::~CoroutineService() {
+        stop();
+
+        // The model signals may still be posted to the executor, they must run before the signals are destroyed
+        modelSignals_.clear();
+        syncExecutor();
+    }
+
+    void CoroutineService::start() {
+        if (running_) return;
+
+        {
+            std::lock_guard lock{doneMutex_};
+            done_ = false;
+        }
+        running_ = true;
+        paused_ = false;
+        stopRequested_ = false; // the previous coroutine returned, nothing else reads it
+
+        task_ = run(); // destroys the previous coroutine
+        executor_.post([this] { task_.start(); });
+
+        logger().info("Service started");
+    }
+
+    void CoroutineService::stop() {
+        bool done;
+        {
+            std::lock_guard lock{doneMutex_};
+            done = done_;
+        }
+
+        if (done) {
+            logger().info("Service was already stopped");
+            return;
+        }
+
+        if (executor_.isExecutorThread()) {
+            // Called by a coroutine of the executor, the coroutine of the service returns once resumed
+            requestStop();
+        } else if (executor_.isWorkerRunning()) {
+            executor_.post([this] { requestStop(); });
+
+            std::unique_lock lock{doneMutex_};
+            doneCv_.wait(lock, [this] { return done_; });
+            lock.unlock();
+
+            syncExecutor(); // the coroutine is suspended for good once the executor ran its next callback
+        } else {
+            requestStop(); // nothing else runs the coroutine, it returns on this thread
+        }
+        paused_ = false;
+
+        logger().info("Service stopped");
+    }
+
+    void CoroutineService::pause() {
+        paused_ = true;
+
+        logger().info("Service paused");
+    }
+
+    void CoroutineService::resume() {
+        paused_ = false;
+        executor_.post([this] { resumeSignal_.fire(); });
+
+        logger().info("Service resumed");
+    }
+
+    Task CoroutineService::waitNextCycle() {
+        co_await sleepFor(updateInterval());
+    }
+
+    ModelSignal& CoroutineService::observe(const common::Observable& model) {
+        return *modelSignals_.emplace_back(std::make_unique<ModelSignal>(executor_, model));
+    }
+
+    CoroutineService::TimerAwaiter CoroutineService::sleepFor(std::chrono::milliseconds duration) {
+        return TimerAwaiter{*this, CoroutineExecutor::Clock::now() + duration};
+    }
+
+    CoroutineService::TimerAwaiter CoroutineService::sleepUntil(std::chrono::system_clock::time_point time_point) {
+        const auto delay = time_point - std::chrono::system_clock::now();
+        return TimerAwaiter{*this, CoroutineExecutor::Clock::now() + std::chrono::ceil<CoroutineExecutor::Clock::duration>(delay)};
+    }
+
+    CoroutineService::ReaderAwaiter CoroutineService::readable(int fd) {
+        return ReaderAwaiter{*this, fd};
+    }
+
+    CoroutineService::SignalAwaiter CoroutineService::changed(ModelSignal& signal) {
+        return SignalAwaiter{*this, signal};
+    }
+
+    Task CoroutineService::run() {
+        if (executeStart()) {
+            while (!stopRequested_) {
+                if (paused_) {
+                    co_await SignalAwaiter{*this, resumeSignal_};
+                    continue;
+                }
+
+                bool failed {false};
+                try {
+                    const auto processStart = CoroutineExecutor::Clock::now();
+                    co_await process();
+
+                    const auto processEnd = CoroutineExecutor::Clock::now();
+                    stats_.recordProcess(processEnd - processStart, logger());
+
+                    if (!stopRequested_) {
+                        co_await waitNextCycle();
+                        stats_.recordWait(CoroutineExecutor::Clock::now() - processEnd);
+                    }
+                }
+                catch (...) {
+                    stats_.recordException(logger());
+                    failed = true;
+                }
+
+                if (failed) {
+                    co_await sleepFor(RETRY_DELAY);
+                }
+            }
+
+            executeStop();
+        }
+
+        finish();
+    }
+
+    void CoroutineService::requestStop() {
+        if (stopRequested_) return;
+        stopRequested_ = true;
+
+        // At most one wait is in progress: the one the coroutine is suspended on, if any
+        auto waiters = executor_.cancel(this);
+
+        for (ServiceSignal* signal : {&resumeSignal_}) {
+            if (signal->waiter_) waiters.push_back(std::exchange(signal->waiter_, nullptr));
+        }
+        for (const auto& signal : modelSignals_) {
+            if (signal->waiter_) waiters.push_back(std::exchange(signal->waiter_, nullptr));
+        }
+
+        for (CoroutineExecutor::Waiter* waiter : waiters) {
+            waiter->cancelled = true;
+            waiter->handle.resume();
+        }
+    }
+
+    void CoroutineService::finish() {
+        running_ = false;
+
+        {
+            std::lock_guard lock{doneMutex_};
+            done_ = true;
+        }
+        doneCv_.notify_all();
+    }
+
+    void CoroutineService::syncExecutor() {
+        if (!executor_.isWorkerRunning() || executor_.isExecutorThread()) return;
+
+        std::promise<void> ran;
+        auto future = ran.get_future();
+        executor_.post([&ran] { ran.set_value(); });
+        future.wait();
+    }
+
+    bool CoroutineService::executeStart() {
+        try {
+            if (!onStart()) {
+                logger().error("Service initialization failed. Stopping service.");
+                return false;
+            }
+            return true;
+        }
+        catch (const std::exception& e) {
+            logger().critical("Fatal exception during onStart: " + std::string(e.what()));
+            return false;
+        }
+        catch (...) {
+            logger().critical("Unknown fatal exception during onStart.");
+            return false;
+        }
+    }
+
+    void CoroutineService::executeStop() {
+        try {
+            onStop();
+        }
+        catch (const std::exception& e) {
+            logger().error("Exception caught during onStop: " + std::string(e.what()));
+        }
+        catch (...) {
+            logger().error("Unknown exception caught during onStop.");
+        }
+    }
+
+} // namespace PiAlarm::service
@@ -0,0 +1,377 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <coroutine>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "common/CycleStats.h"
+#include "common/Observable.hpp"
+#include "common/Observer.h"
+#include "CoroutineExecutor.h"
+#include "IService.h"
+#include "logging/HasLogger.h"
+#include "Task.h"
+
+namespace PiAlarm::service {
+
+    /**
+     * @class ServiceSignal
+     * @brief Event the coroutine of a service can wait for, fired on the executor thread.
+     *
+     * A signal fired while nothing waits for it is kept, the next wait then completes at once.
+     */
+    class ServiceSignal {
+        friend class CoroutineService;
+
+        CoroutineExecutor::Waiter* waiter_ {nullptr}; ///< The waiting coroutine, if any
+        bool pending_ {false}; ///< Whether the signal was fired while nothing waited for it
+
+    public:
+        virtual ~ServiceSignal() = default;
+
+        /**
+         * @brief Resumes the waiting coroutine, or keeps the signal for the next wait.
+         * Must be called from the executor thread.
+         */
+        void fire();
+    };
+
+    /**
+     * @class ModelSignal
+     * @brief Signal fired when a model notifies its observers, from whatever thread it changes on.
+     */
+    class ModelSignal final : public ServiceSignal, public common::Observer {
+        CoroutineExecutor& executor_; ///< Executor the signal is fired on
+        const common::Observable& model_; ///< The observed model
+
+    public:
+
+        /**
+         * @brief Constructs the signal and registers it as an observer of the model.
+         * @param executor The executor the signal is fired on.
+         * @param model The model to observe, it must outlive the signal.
+         */
+        ModelSignal(CoroutineExecutor& executor, const common::Observable& model);
+
+        /**
+         * @brief Unregisters the signal from the model.
+         */
+        ~ModelSignal() override;
+
+        /**
+         * @brief Called by the model when it changes, fires the signal on the executor thread.
+         */
+        void update() override;
+    };
+
+    /**
+     * @class CoroutineService
+     * @brief Base class for services written as coroutines, all run by one CoroutineExecutor thread.
+     *
+     * It keeps the contract of BaseService: onStart(), then process() and waitNextCycle() repeatedly, then onStop();
+     * but process() and waitNextCycle() are coroutines that suspend instead of blocking, with co_await on:
+     * - sleepFor() / sleepUntil(): a timer,
+     * - readable(): a readable file descriptor,
+     * - changed(): a change of a model registered with observe().
+     * Each wait returns true once it completes, and false if the service was stopped meanwhile:
+     * the coroutine is then expected to return.
+     *
+     * Many services then share a single thread, which only wakes up when one of them has something to do.
+     * A coroutine must not block: a blocking call (e.g. a synchronous HTTP request) holds every service of the executor.
+     *
+     * Each cycle is timed in the CycleStats of the service, the lateness being the one of the timers.
+     * A process() longer than the cycle budget is logged, its duration includes the waits it awaits.
+     */
+    class CoroutineService : public IService, protected logging::HasLogger {
+        friend class ServiceSignal;
+
+        static constexpr std::chrono::milliseconds RETRY_DELAY {500}; ///< Delay before the next cycle when one throws
+
+        CoroutineExecutor& executor_; ///< Executor running the coroutine
+        Task task_; ///< The main coroutine of the service, see run()
+
+        std::atomic<bool> running_ {false}; ///< Indicates if the service is currently running
+        std::atomic<bool> paused_ {false}; ///< Indicates if the service is currently paused
+
+        // State of the coroutine, used by the executor thread (or while it is stopped)
+        bool stopRequested_ {false}; ///< Whether the coroutine must return
+        ServiceSignal resumeSignal_; ///< Fired when the service is resumed
+        std::vector<std::unique_ptr<ModelSignal>> modelSignals_; ///< Signals of the observed models
+
+        std::mutex doneMutex_; ///< Mutex guarding done_
+        std::condition_variable doneCv_; ///< Signaled when the coroutine returns
+        bool done_ {true}; ///< Whether the coroutine returned
+
+        common::CycleStats stats_; ///< Timing of the cycles of the service
+
+    protected:
+
+        /**
+         * @class WaitAwaiter
+         * @brief Common part of the waits: completes at once if the service is stopping,
+         * and tells if the wait completed or was cancelled.
+         */
+        class WaitAwaiter {
+        protected:
+            CoroutineService& service_; ///< The waiting service
+            CoroutineExecutor::Waiter waiter_ {}; ///< The registration of the wait
+
+        public:
+            explicit WaitAwaiter(CoroutineService& service) : service_{service} {
+                waiter_.owner = &service;
+            }
+
+            bool await_ready() const noexcept { return service_.stopRequested_; }
+
+            bool await_resume() const noexcept { return !waiter_.cancelled && !service_.stopRequested_; }
+        };
+
+        /**
+         * @class TimerAwaiter
+         * @brief Waits until a time of the steady clock, and records how late it resumed.
+         */
+        class TimerAwaiter final : public WaitAwaiter {
+            CoroutineExecutor::TimePoint time_; ///< Time to resume at
+
+        public:
+            TimerAwaiter(CoroutineService& service, CoroutineExecutor::TimePoint time) : WaitAwaiter{service}, time_{time} {}
+
+            void await_suspend(std::coroutine_handle<> handle) {
+                waiter_.handle = handle;
+                service_.executor_.addTimer(time_, waiter_);
+            }
+
+            bool await_resume() const {
+                if (!WaitAwaiter::await_resume()) return false;
+
+                service_.stats_.recordLateness(CoroutineExecutor::Clock::now() - time_);
+                return true;
+            }
+        };
+
+        /**
+         * @class ReaderAwaiter
+         * @brief Waits until a file descriptor is readable.
+         */
+        class ReaderAwaiter final : public WaitAwaiter {
+            int fd_; ///< The file descriptor
+
+        public:
+            ReaderAwaiter(CoroutineService& service, int fd) : WaitAwaiter{service}, fd_{fd} {}
+
+            void await_suspend(std::coroutine_handle<> handle) {
+                waiter_.handle = handle;
+                service_.executor_.addReader(fd_, waiter_);
+            }
+        };
+
+        /**
+         * @class SignalAwaiter
+         * @brief Waits until a signal is fired, completes at once if it was fired since the last wait.
+         */
+        class SignalAwaiter final : public WaitAwaiter {
+            ServiceSignal& signal_; ///< The awaited signal
+
+        public:
+            SignalAwaiter(CoroutineService& service, ServiceSignal& signal) : WaitAwaiter{service}, signal_{signal} {}
+
+            bool await_ready() const noexcept {
+                if (service_.stopRequested_) return true;
+                return std::exchange(signal_.pending_, false);
+            }
+
+            void await_suspend(std::coroutine_handle<> handle) noexcept {
+                waiter_.handle = handle;
+                signal_.waiter_ = &waiter_;
+            }
+        };
+
+    public:
+
+        /**
+         * @brief Constructor for CoroutineService.
+         * @param executor The executor running the coroutine of the service, it must outlive the service.
+         * @param serviceName The name of the service.
+         */
+        CoroutineService(CoroutineExecutor& executor, const std::string& serviceName);
+
+        /**
+         * @brief Destructor, stops the service.
+         */
+        ~CoroutineService() override;
+
+        /**
+         * @brief Starts the service: its coroutine is started on the executor thread.
+         * If the service is already running, this method does nothing.
+         */
+        void start() override;
+
+        /**
+         * @brief Stops the service: the wait in progress completes with false, the coroutine returns and onStop() is called.
+         * Waits for the coroutine to return, unless called from the executor thread (e.g. by the service itself).
+         * If the service is not running, this method does nothing.
+         */
+        void stop() override;
+
+        /**
+         * @brief Pauses the service: the cycle in progress finishes, the next one waits for resume().
+         */
+        void pause() override;
+
+        /**
+         * @brief Resumes the service if it is paused.
+         */
+        void resume() override;
+
+        /**
+         * @brief Checks if the service is currently running.
+         * @return true if the service is running, false otherwise.
+         */
+        [[nodiscard]]
+        bool isRunning() const override { return running_.load(); }
+
+        /**
+         * @brief Checks if the service is currently paused.
+         * @return true if the service is paused, false otherwise.
+         */
+        [[nodiscard]]
+        bool isPaused() const override { return paused_.load(); }
+
+        /**
+         * @brief Gets the timing of the cycles of the service.
+         * @return The stats, which can be read while the service runs.
+         */
+        [[nodiscard]]
+        const common::CycleStats& getCycleStats() const { return stats_; }
+
+        /**
+         * @brief Sets the longest process() that is not logged as an overrun.
+         * @param budget The budget, zero to disable the check.
+         */
+        void setCycleBudget(std::chrono::milliseconds budget) { stats_.setBudget(budget); }
+
+    protected:
+
+        /**
+         * @brief Method called on the executor thread before the first cycle.
+         * If it returns false, the service will stop immediately.
+         * @return true if initialization succeeded, false otherwise.
+         */
+        virtual bool onStart() { return true; }
+
+        /**
+         * @brief Method called on the executor thread once the service is stopped, if onStart() succeeded.
+         */
+        virtual void onStop() {}
+
+        /**
+         * @brief Coroutine to be implemented by derived classes for service-specific functionality.
+         * It is run repeatedly until the service is stopped.
+         * @return The coroutine.
+         */
+        virtual Task process() = 0;
+
+        /**
+         * @brief Coroutine waiting before the next cycle.
+         * The default implementation sleeps for the value returned by updateInterval().
+         * @return The coroutine.
+         */
+        virtual Task waitNextCycle();
+
+        /**
+         * @brief Returns the update interval used by the default implementation of waitNextCycle().
+         * @return Interval between update cycles. Default is 1000 ms (1 second).
+         */
+        [[nodiscard]]
+        virtual std::chrono::milliseconds updateInterval() const {
+            return std::chrono::milliseconds{1000};
+        }
+
+        /**
+         * @brief Registers a model whose changes the service can wait for with changed().
+         * Must be called before the service is started, typically in the constructor.
+         * @param model The model to observe, it must outlive the service.
+         * @return The signal of the model.
+         */
+        ModelSignal& observe(const common::Observable& model);
+
+        /**
+         * @brief Waits for a duration.
+         * @param duration The duration to wait for.
+         * @return An awaiter resuming with true once the duration elapsed, false if the service was stopped.
+         */
+        [[nodiscard]]
+        TimerAwaiter sleepFor(std::chrono::milliseconds duration);
+
+        /**
+         * @brief Waits until a time of the wall clock, converted to the steady clock when called.
+         * @param time_point The time to wait until.
+         * @return An awaiter resuming with true once the time is reached, false if the service was stopped.
+         */
+        [[nodiscard]]
+        TimerAwaiter sleepUntil(std::chrono::system_clock::time_point time_point);
+
+        /**
+         * @brief Waits until a file descriptor is readable (Linux only).
+         * @param fd The file descriptor, it must stay open during the wait.
+         * @return An awaiter resuming with true once the file descriptor is readable, false if the service was stopped.
+         */
+        [[nodiscard]]
+        ReaderAwaiter readable(int fd);
+
+        /**
+         * @brief Waits until an observed model changes.
+         * @param signal The signal returned by observe() for the model.
+         * @return An awaiter resuming with true once the model changed, false if the service was stopped.
+         */
+        [[nodiscard]]
+        SignalAwaiter changed(ModelSignal& signal);
+
+        /**
+         * @brief Gets the executor running the service.
+         * @return The executor.
+         */
+        [[nodiscard]]
+        CoroutineExecutor& executor() const { return executor_; }
+
+    private:
+
+        /**
+         * @brief Main coroutine: onStart(), the cycles until stopped, then onStop().
+         * @return The coroutine.
+         */
+        Task run();
+
+        /**
+         * @brief Cancels the wait in progress and makes the coroutine return. Called on the executor thread.
+         */
+        void requestStop();
+
+        /**
+         * @brief Marks the coroutine as returned and wakes stop() up.
+         */
+        void finish();
+
+        /**
+         * @brief Waits until the executor ran the callbacks posted so far, unless called from it or it is stopped.
+         */
+        void syncExecutor();
+
+        /**
+         * @brief Calls onStart() safely, intercepting all potential exceptions.
+         * @return true if initialization succeeded, false otherwise.
+         */
+        bool executeStart();
+
+        /**
+         * @brief Calls onStop() safely, intercepting all potential exceptions.
+         */
+        void executeStop();
+    };
+
+} // namespace PiAlarm::service
@@ -4,10 +4,11 @@
 
 namespace PiAlarm::service {
     SCD41Service::SCD41Service(
+        CoroutineExecutor& executor,
         model::CO2Data& CO2Data,
         const model::CurrentIndoorData& currentIndoorData
     )
-        : BaseService("SCD41Service"),
+        : CoroutineService(executor, "SCD41Service"),
           co2Data_{CO2Data},
           currentIndoorData_{currentIndoorData}
     {}
@@ -34,11 +35,11 @@ namespace PiAlarm::service {
         }
     }
 
-    void SCD41Service::process() {
+    Task SCD41Service::process() {
         try {
-            if (currentIndoorData_.isValid()) {
+            if (const auto indoor = currentIndoorData_.snapshot(); indoor.valid) {
                 // use indoor pressure to improve co2 measurement value
-                scd41_.setAmbientPressure(static_cast<uint16_t>(currentIndoorData_.getPressure()));
+                scd41_.setAmbientPressure(static_cast<uint16_t>(indoor.pressure));
             }
 
             if (scd41_.dataReady()) {
@@ -52,6 +53,7 @@ namespace PiAlarm::service {
             co2Data_.setValid(false);
             logger().error("Failed to read from SCD41 sensor: {}", e.what());
         }
+        co_return;
     }
 
     std::chrono::milliseconds SCD41Service::updateInterval() const {
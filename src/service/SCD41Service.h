@@ -2,7 +2,7 @@
 
 #ifdef SENSOR_SCD41
 
-#include "BaseService.h"
+#include "CoroutineService.h"
 #include "hardware/SCD41.h"
 #include "model/CO2Data.hpp"
 #include "model/CurrentIndoorData.hpp"
@@ -13,7 +13,7 @@ namespace PiAlarm::service {
      * @class SCD41Service
      * @brief Service for fetching and updating indoor environmental data from the SCD41 sensor.
      */
-    class SCD41Service : public BaseService {
+    class SCD41Service : public CoroutineService {
         hardware::SCD41 scd41_; ///< SCD41 sensor for indoor measurements.
         model::CO2Data& co2Data_; ///< Reference to the CO2Data model to be updated with sensor readings.
         const model::CurrentIndoorData& currentIndoorData_; ///< Reference to the CurrentIndoorData model to be notified when pressure changes.
@@ -21,10 +21,11 @@ namespace PiAlarm::service {
     public:
         /**
          * @brief Constructs a CurrentIndoorService that updates the CO2Data model with sensor data.
+         * @param executor The executor running the service.
          * @param CO2Data Reference to the CO2Data model to be updated with sensor readings.
          * @param currentIndoorData Reference to the CurrentIndoorData model to be notified when pressure changes.
          */
-        explicit SCD41Service(model::CO2Data& CO2Data, const model::CurrentIndoorData& currentIndoorData);
+        SCD41Service(CoroutineExecutor& executor, model::CO2Data& CO2Data, const model::CurrentIndoorData& currentIndoorData);
 
     protected:
         /**
@@ -41,7 +42,7 @@ namespace PiAlarm::service {
         /**
          * @brief Updates the data in the CO2Data model.
          */
-        void process() override;
+        Task process() override;
 
         /**
          * @brief Returns the update interval for the service.
@@ -0,0 +1,224 @@
+#include <algorithm>
+#include <utility>
+
+#include "ServiceScheduler.h"
+#include "BaseService.h"
+
+namespace PiAlarm::service {
+
+    ServiceScheduler::ServiceScheduler(size_t workerCount)
+        : HasLogger{"ServiceScheduler"},
+          workerCount_{std::max<size_t>(workerCount, 1)},
+          epoch_{Clock::now()}
+    {}
+
+    ServiceScheduler::~ServiceScheduler() {
+        stop();
+    }
+
+    void ServiceScheduler::start() {
+        std::lock_guard lock{mutex_};
+        if (!workers_.empty()) return;
+
+        stopping_ = false;
+        for (size_t i {0}; i < workerCount_; ++i) {
+            workers_.emplace_back([this] { workerLoop(); });
+        }
+
+        logger().info("Scheduler started with {} threads", workerCount_);
+    }
+
+    void ServiceScheduler::stop() {
+        std::vector<std::thread> workers;
+        {
+            std::lock_guard lock{mutex_};
+            if (workers_.empty()) return;
+
+            stopping_ = true;
+            workers.swap(workers_);
+        }
+        readyCv_.notify_all();
+        timerCv_.notify_all();
+
+        for (std::thread& worker : workers) {
+            worker.join();
+        }
+
+        logger().info("Scheduler stopped");
+    }
+
+    void ServiceScheduler::add(BaseService& service) {
+        std::lock_guard lock{mutex_};
+        if (service.scheduled_) return;
+
+        service.scheduled_ = true;
+        service.parked_ = false;
+        service.dueCycle_.reset();
+        pushReady(service);
+    }
+
+    bool ServiceScheduler::remove(BaseService& service, bool waitCycle) {
+        std::unique_lock lock{mutex_};
+        if (!service.scheduled_) return false;
+
+        service.scheduled_ = false;
+        service.parked_ = false;
+        std::erase(ready_, &service);
+        wheel_.cancelIf([&service](const BaseService* scheduled) { return scheduled == &service; });
+
+        if (waitCycle) {
+            idleCv_.wait(lock, [&service] { return !service.inCycle_; });
+        }
+        return true;
+    }
+
+    void ServiceScheduler::pause(BaseService& service) {
+        std::lock_guard lock{mutex_};
+        service.paused_ = true;
+        service.dueCycle_.reset(); // its next cycle may wait for resume(), it is not late
+    }
+
+    void ServiceScheduler::resume(BaseService& service) {
+        std::lock_guard lock{mutex_};
+        service.paused_ = false;
+
+        if (service.parked_) {
+            service.parked_ = false;
+            pushReady(service);
+        }
+    }
+
+    void ServiceScheduler::workerLoop() {
+        std::unique_lock lock{mutex_};
+
+        while (!stopping_) {
+            if (!ready_.empty()) {
+                BaseService& service = *ready_.front();
+                ready_.pop_front();
+
+                if (service.paused_) {
+                    service.parked_ = true; // its cycle runs on resume
+                    continue;
+                }
+
+                runCycle(service, lock);
+            } else if (!hasTimekeeper_) {
+                keepTime(lock);
+            } else {
+                ++idleWorkers_;
+                readyCv_.wait(lock);
+                --idleWorkers_;
+            }
+        }
+    }
+
+    void ServiceScheduler::keepTime(std::unique_lock<std::mutex>& lock) {
+        hasTimekeeper_ = true;
+
+        while (!stopping_) {
+            wheel_.advance(nowTick(), expired_);
+
+            if (!expired_.empty()) {
+                for (BaseService* service : expired_) {
+                    ready_.push_back(service);
+                }
+                expired_.clear();
+
+                // The extra ready cycles go to the idle threads, this one runs the first
+                for (size_t i {1}; i < std::min(ready_.size(), idleWorkers_ + 1); ++i) {
+                    readyCv_.notify_one();
+                }
+                break;
+            }
+
+            const auto nextTick = wheel_.getNextTick();
+            timekeeperDeadline_ = nextTick ? std::optional{toTime(*nextTick)} : std::nullopt;
+
+            if (timekeeperDeadline_) {
+                timerCv_.wait_until(lock, *timekeeperDeadline_);
+            } else {
+                timerCv_.wait(lock);
+            }
+
+            if (!ready_.empty()) break; // a service was added or resumed
+        }
+
+        hasTimekeeper_ = false;
+        timekeeperDeadline_.reset();
+    }
+
+    void ServiceScheduler::runCycle(BaseService& service, std::unique_lock<std::mutex>& lock) {
+        // Hand the timekeeping over if this cycle could still be running when the next one is due
+        if (!hasTimekeeper_ && idleWorkers_ > 0 && ready_.empty()) {
+            const auto nextTick = wheel_.getNextTick();
+            if (nextTick && (!service.lastCycleDuration_ ||
+                             Clock::now() + 2 * *service.lastCycleDuration_ >= toTime(*nextTick))) {
+                readyCv_.notify_one();
+            }
+        }
+
+        service.inCycle_ = true;
+        const auto due = std::exchange(service.dueCycle_, std::nullopt);
+        const auto lastEnd = service.lastCycleEnd_;
+        lock.unlock();
+
+        const auto start = Clock::now();
+        if (due) {
+            service.stats_.recordWait(start - lastEnd);
+            service.stats_.recordLateness(start - *due);
+        }
+
+        const bool keepRunning = service.executeCycle();
+        const auto end = Clock::now();
+
+        lock.lock();
+        service.inCycle_ = false;
+        service.lastCycleDuration_ = end - start;
+        service.lastCycleEnd_ = end;
+
+        if (service.scheduled_) {
+            if (keepRunning) {
+                scheduleNext(service);
+            } else {
+                service.scheduled_ = false;
+            }
+        }
+        idleCv_.notify_all();
+    }
+
+    void ServiceScheduler::pushReady(BaseService& service) {
+        ready_.push_back(&service);
+
+        if (idleWorkers_ > 0) {
+            readyCv_.notify_one();
+        } else {
+            timerCv_.notify_one(); // the timekeeper runs it
+        }
+    }
+
+    void ServiceScheduler::scheduleNext(BaseService& service) {
+        const Wheel::Tick tick = toTick(service.nextCycle_);
+        wheel_.schedule(tick, &service);
+        service.dueCycle_ = service.nextCycle_;
+
+        // The timekeeper must wake up earlier, or it is busy and checks the wheel once done
+        if (hasTimekeeper_ && (!timekeeperDeadline_ || toTime(tick) < *timekeeperDeadline_)) {
+            timerCv_.notify_one();
+        }
+    }
+
+    ServiceScheduler::Wheel::Tick ServiceScheduler::nowTick() const {
+        const auto elapsed = std::chrono::floor<std::chrono::milliseconds>(Clock::now() - epoch_);
+        return static_cast<Wheel::Tick>(std::max<std::chrono::milliseconds::rep>(elapsed / TICK, 0));
+    }
+
+    ServiceScheduler::Wheel::Tick ServiceScheduler::toTick(TimePoint time) const {
+        const auto elapsed = std::chrono::ceil<std::chrono::milliseconds>(time - epoch_);
+        return static_cast<Wheel::Tick>(std::max<std::chrono::milliseconds::rep>(elapsed / TICK, 0));
+    }
+
+    ServiceScheduler::TimePoint ServiceScheduler::toTime(Wheel::Tick tick) const {
+        return epoch_ + TICK * static_cast<std::chrono::milliseconds::rep>(tick);
+    }
+
+} // namespace PiAlarm::service
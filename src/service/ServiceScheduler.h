@@ -0,0 +1,186 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+#include "common/TimerWheel.hpp"
+#include "logging/HasLogger.h"
+
+namespace PiAlarm::service {
+
+    class BaseService;
+
+    /**
+     * @class ServiceScheduler
+     * @brief Runs the cycles of every service on a small fixed pool of threads.
+     *
+     * A service does not own a thread: after each cycle, it tells when its next cycle is due,
+     * and the scheduler keeps that time in a hierarchical timer wheel with a resolution of TICK.
+     * One idle thread of the pool sleeps until the next due cycle and hands it over to the pool,
+     * the other idle threads sleep until there is a cycle to run. Adding a service therefore adds neither
+     * a thread nor a periodic wake up.
+     * The timekeeper runs a due cycle itself, and only hands the timekeeping over to another thread
+     * when the last duration of that cycle says it could still be running when the next one is due.
+     *
+     * A cycle is run by one thread at a time, so a service never runs concurrently with itself.
+     * A long cycle (e.g. a network request) only holds one thread of the pool.
+     */
+    class ServiceScheduler final : public logging::HasLogger {
+    public:
+        using Clock = std::chrono::steady_clock; ///< Clock the cycles are scheduled on
+        using TimePoint = Clock::time_point; ///< Alias for the time of a cycle
+
+        static constexpr std::chrono::milliseconds TICK {1}; ///< Resolution of the cycle times
+        static constexpr size_t DEFAULT_WORKER_COUNT {2}; ///< Number of threads of the pool by default
+
+    private:
+        using Wheel = common::TimerWheel<BaseService*>; ///< Alias for the timer wheel type
+
+        const size_t workerCount_; ///< Number of threads of the pool
+        const TimePoint epoch_; ///< Time of the tick 0 of the wheel
+
+        std::mutex mutex_; ///< Mutex guarding the state below and the scheduling state of the services
+        std::condition_variable readyCv_; ///< Signaled when a cycle is ready to run or the pool is stopping
+        std::condition_variable timerCv_; ///< Signaled when the timekeeper must check the wheel again
+        std::condition_variable idleCv_; ///< Signaled when a cycle ends, for remove() waiting on it
+
+        Wheel wheel_; ///< Next cycle of each waiting service
+        std::deque<BaseService*> ready_; ///< Services whose cycle is due, in order
+        std::vector<BaseService*> expired_; ///< Buffer for the services taken from the wheel
+        std::vector<std::thread> workers_; ///< Threads of the pool
+        bool stopping_ {false}; ///< Whether the pool is stopping
+        bool hasTimekeeper_ {false}; ///< Whether an idle thread is sleeping until the next due cycle
+        std::optional<TimePoint> timekeeperDeadline_ {}; ///< Time the timekeeper sleeps until, empty if it sleeps with no limit
+        size_t idleWorkers_ {0}; ///< Number of threads waiting for a ready cycle, the timekeeper excluded
+
+    public:
+
+        /**
+         * @brief Constructs the scheduler. The threads are created by start().
+         * @param workerCount Number of threads of the pool, at least 1.
+         */
+        explicit ServiceScheduler(size_t workerCount = DEFAULT_WORKER_COUNT);
+
+        /**
+         * @brief Destructor, stops the pool.
+         */
+        ~ServiceScheduler() override;
+
+        ServiceScheduler(const ServiceScheduler&) = delete; ///< No copy constructor
+        ServiceScheduler& operator=(const ServiceScheduler&) = delete; ///< No copy assignment operator
+
+        /**
+         * @brief Creates the threads of the pool. Does nothing if they are running.
+         */
+        void start();
+
+        /**
+         * @brief Stops the threads of the pool, after the cycles being run. Does nothing if they are not running.
+         * The services keep their schedule, their next cycles run once the pool is started again.
+         */
+        void stop();
+
+        /**
+         * @brief Gets the number of threads of the pool.
+         * @return The number of threads.
+         */
+        [[nodiscard]]
+        inline size_t getWorkerCount() const;
+
+    private:
+        friend class BaseService; // services schedule themselves through the methods below
+
+        /**
+         * @brief Adds a service, its first cycle runs as soon as a thread is free.
+         * @param service The service, not scheduled yet.
+         */
+        void add(BaseService& service);
+
+        /**
+         * @brief Removes a service, waiting for its cycle to end if one is running.
+         * @param service The service to remove.
+         * @param waitCycle Whether to wait for the running cycle, false when called from that cycle.
+         * @return True if the service was scheduled.
+         */
+        bool remove(BaseService& service, bool waitCycle = true);
+
+        /**
+         * @brief Pauses a service: a cycle running finishes, the next ones wait for resume().
+         * @param service The service to pause.
+         */
+        void pause(BaseService& service);
+
+        /**
+         * @brief Resumes a paused service. A cycle that came due during the pause runs at once.
+         * @param service The service to resume.
+         */
+        void resume(BaseService& service);
+
+        /**
+         * @brief Main loop of a thread of the pool: runs the ready cycles, or sleeps.
+         */
+        void workerLoop();
+
+        /**
+         * @brief Sleeps until the next due cycle as the timekeeper, then moves the due cycles to the ready queue.
+         * @param lock The held lock on mutex_.
+         */
+        void keepTime(std::unique_lock<std::mutex>& lock);
+
+        /**
+         * @brief Runs a cycle of a service, then schedules its next one.
+         * @param service The service, taken from the ready queue.
+         * @param lock The held lock on mutex_, released while the cycle runs.
+         */
+        void runCycle(BaseService& service, std::unique_lock<std::mutex>& lock);
+
+        /**
+         * @brief Queues a service whose cycle is due, and wakes a thread up to run it. mutex_ must be held.
+         * @param service The service to queue.
+         */
+        void pushReady(BaseService& service);
+
+        /**
+         * @brief Puts the next cycle of a service in the wheel, and wakes the timekeeper up if it is earlier
+         * than the time it sleeps until. mutex_ must be held.
+         * @param service The service, whose next cycle time is set.
+         */
+        void scheduleNext(BaseService& service);
+
+        /**
+         * @brief Gets the last tick started at the current time.
+         * @return The tick, rounded down.
+         */
+        [[nodiscard]]
+        Wheel::Tick nowTick() const;
+
+        /**
+         * @brief Converts a time to the tick of the wheel it is due at, rounded up.
+         * @param time The time to convert.
+         * @return The tick.
+         */
+        [[nodiscard]]
+        Wheel::Tick toTick(TimePoint time) const;
+
+        /**
+         * @brief Converts a tick of the wheel to a time.
+         * @param tick The tick to convert.
+         * @return The time the tick starts at.
+         */
+        [[nodiscard]]
+        TimePoint toTime(Wheel::Tick tick) const;
+    };
+
+    // Inline methods implementation
+
+    inline size_t ServiceScheduler::getWorkerCount() const {
+        return workerCount_;
+    }
+
+} // namespace PiAlarm::service
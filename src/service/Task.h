@@ -0,0 +1,132 @@
+#pragma once
+
+#include <coroutine>
+#include <exception>
+#include <utility>
+
+namespace PiAlarm::service {
+
+    /**
+     * @class Task
+     * @brief Coroutine returning nothing, started when it is awaited or resumed.
+     *
+     * A Task does not run until it is awaited by another coroutine, which resumes once the task is done
+     * (the exceptions of the task are rethrown there), or until its root is resumed by start().
+     * The Task object owns the coroutine frame and destroys it, it must only be destroyed while the coroutine
+     * is not running: before it starts, once it is done, or while suspended with nothing left to resume it.
+     */
+    class Task {
+    public:
+
+        /**
+         * @struct promise_type
+         * @brief Promise of the coroutine, keeps the coroutine to resume once done and the escaped exception.
+         */
+        struct promise_type {
+            std::coroutine_handle<> continuation {std::noop_coroutine()}; ///< Coroutine awaiting the task, none for a root
+            std::exception_ptr exception {}; ///< Exception escaped from the coroutine
+
+            /**
+             * @brief Creates the Task owning the coroutine.
+             * @return The task.
+             */
+            Task get_return_object() noexcept {
+                return Task{std::coroutine_handle<promise_type>::from_promise(*this)};
+            }
+
+            /**
+             * @brief The coroutine does not run until it is awaited or started.
+             */
+            std::suspend_always initial_suspend() noexcept { return {}; }
+
+            /**
+             * @brief Once done, the coroutine resumes the one awaiting it.
+             */
+            auto final_suspend() noexcept {
+                struct FinalAwaiter {
+                    bool await_ready() noexcept { return false; }
+
+                    std::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type> handle) noexcept {
+                        return handle.promise().continuation; // symmetric transfer, no stack growth
+                    }
+
+                    void await_resume() noexcept {}
+                };
+                return FinalAwaiter{};
+            }
+
+            void return_void() noexcept {}
+
+            void unhandled_exception() noexcept { exception = std::current_exception(); }
+        };
+
+    private:
+        std::coroutine_handle<promise_type> handle_ {}; ///< The owned coroutine, empty if moved from
+
+    public:
+
+        Task() = default;
+
+        /**
+         * @brief Destroys the coroutine frame.
+         */
+        ~Task() {
+            if (handle_) handle_.destroy();
+        }
+
+        Task(Task&& other) noexcept : handle_{std::exchange(other.handle_, {})} {}
+
+        Task& operator=(Task&& other) noexcept {
+            if (this != &other) {
+                if (handle_) handle_.destroy();
+                handle_ = std::exchange(other.handle_, {});
+            }
+            return *this;
+        }
+
+        Task(const Task&) = delete; ///< No copy constructor
+        Task& operator=(const Task&) = delete; ///< No copy assignment operator
+
+        /**
+         * @brief Runs the coroutine as a root, until its first suspension.
+         */
+        void start() const {
+            handle_.resume();
+        }
+
+        /**
+         * @brief Checks if the coroutine is done.
+         * @return True if it returned or threw, or if the task is empty.
+         */
+        [[nodiscard]]
+        bool isDone() const {
+            return !handle_ || handle_.done();
+        }
+
+        // Awaiting a task runs it, the awaiting coroutine resumes once it is done
+
+        bool await_ready() const noexcept {
+            return isDone();
+        }
+
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) const noexcept {
+            handle_.promise().continuation = awaiting;
+            return handle_;
+        }
+
+        void await_resume() const {
+            if (handle_ && handle_.promise().exception) {
+                std::rethrow_exception(handle_.promise().exception);
+            }
+        }
+
+    private:
+
+        /**
+         * @brief Constructs the task owning a coroutine.
+         * @param handle The coroutine.
+         */
+        explicit Task(std::coroutine_handle<promise_type> handle) : handle_{handle} {}
+    };
+
+} // namespace PiAlarm::service
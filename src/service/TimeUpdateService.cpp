@@ -5,22 +5,23 @@
 
 namespace PiAlarm::service {
 
-    TimeUpdateService::TimeUpdateService(model::ClockData &clockData)
-        : BaseService("TimeUpdateService"), clockData_{clockData}
+    TimeUpdateService::TimeUpdateService(CoroutineExecutor& executor, model::ClockData &clockData)
+        : CoroutineService(executor, "TimeUpdateService"), clockData_{clockData}
     {}
 
-    void TimeUpdateService::process() {
+    Task TimeUpdateService::process() {
         clockData_.setCurrentTime(model::Time::now());
+        co_return;
     }
 
-    void TimeUpdateService::waitNextCycle() {
+    Task TimeUpdateService::waitNextCycle() {
         using namespace std::chrono;
 
         const auto now = system_clock::now();
 
-        // use a time_point to specify the exact next second instant to wait until,
+        // use a time_point to specify the exact next second instant to run at,
         // ensuring precise synchronization with the system clock,
-        // rather than waiting a fixed duration which can accumulate drift.
+        // rather than a fixed delay which can accumulate drift.
         auto next_tick = time_point_cast<seconds>(now) + seconds{1};
 
         // if we’re already past next tick (possible with low-precision clocks), add another second
@@ -28,7 +29,7 @@ namespace PiAlarm::service {
             next_tick += seconds{1};
         }
 
-        interruptibleSleepUntil(next_tick);
+        co_await sleepUntil(next_tick);
     }
 
 } // namespace PiAlarm::service
\ No newline at end of file
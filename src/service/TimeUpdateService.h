@@ -1,6 +1,6 @@
 #pragma once
 
-#include "BaseService.h"
+#include "CoroutineService.h"
 #include "model/ClockData.hpp"
 
 namespace PiAlarm::service {
@@ -12,30 +12,31 @@ namespace PiAlarm::service {
      * This service updates the current time in the ClockData model every second,
      * ensuring that the time is always accurate and synchronized with the system clock.
      */
-    class TimeUpdateService final : public BaseService {
+    class TimeUpdateService final : public CoroutineService {
         model::ClockData &clockData_; ///< Reference to the ClockData model to update time
 
     public:
 
         /**
          * @brief Constructs a TimeUpdateService that updates the current time in the ClockData model.
+         * @param executor The executor running the service.
          * @param clockData Reference to the ClockData model to be updated.
          */
-        explicit TimeUpdateService(model::ClockData &clockData);
+        TimeUpdateService(CoroutineExecutor& executor, model::ClockData &clockData);
 
     protected:
         /**
          * @brief Updates the current time in the ClockData model.
          */
-        void process() override;
+        Task process() override;
 
         /**
          * @brief Waits until the next second to ensure precise time updates.
          *
-         * This method uses a time_point to wait until the start of the next second,
+         * This method uses a time_point to resume at the start of the next second,
          * ensuring that the time is updated exactly once per second without drift.
          */
-        void waitNextCycle() override;
+        Task waitNextCycle() override;
     };
 
 } // namespace PiAlarm::service
\ No newline at end of file
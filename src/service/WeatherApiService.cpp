@@ -3,13 +3,16 @@
 namespace PiAlarm::service {
 
     WeatherApiService::WeatherApiService(
+        ServiceScheduler& scheduler,
         model::CurrentWeatherData& currentWeatherData,
         const std::string& cityName
     )
-        : BaseService{"WeatherApiService"},
+        : BaseService{scheduler, "WeatherApiService"},
           currentWeatherData_{currentWeatherData},
           weatherApiClient_{cityName}
-    {}
+    {
+        setCycleBudget(HTTP_CYCLE_BUDGET); // process() waits for an HTTP response
+    }
 
     void WeatherApiService::process() {
         const auto result {weatherApiClient_.fetchCurrentWeather()};
@@ -19,6 +19,7 @@ namespace PiAlarm::service {
 
         static constexpr int MAX_FAILURE_COUNT {2}; ///< Maximum allowed consecutive failures before logging an error
         static constexpr std::chrono::minutes MINUTE_ALIGNMENT {5}; ///< Minute alignment for periodic updates
+        static constexpr std::chrono::seconds HTTP_CYCLE_BUDGET {5}; ///< Longest fetch not logged as an overrun
 
         int failureCount_ = 0; ///< Counter for consecutive failures in fetching weather data
 
@@ -26,10 +27,12 @@ namespace PiAlarm::service {
 
         /**
          * @brief Constructs a WeatherApiService that updates the CurrentWeatherData model with weather data.
+         * @param scheduler The scheduler running the service.
          * @param currentWeatherData Reference to the CurrentWeatherData model to be updated.
          * @param cityName The name of the city for which to fetch weather data.
          */
-        explicit WeatherApiService(
+        WeatherApiService(
+            ServiceScheduler& scheduler,
             model::CurrentWeatherData &currentWeatherData,
             const std::string& cityName
         );
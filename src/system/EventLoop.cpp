@@ -0,0 +1,161 @@
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <climits>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+#ifdef __linux__
+    #include <sys/epoll.h>
+    #include <sys/eventfd.h>
+    #include <sys/timerfd.h>
+    #include <ctime>
+    #include <unistd.h>
+#endif
+
+#include "EventLoop.h"
+
+namespace PiAlarm::system {
+
+#ifdef __linux__
+
+EventLoop::EventLoop(bool secondTicks)
+    : secondTicks_{secondTicks}
+{
+    epollFd_ = epoll_create1(EPOLL_CLOEXEC);
+    notifyFd_ = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (secondTicks_) timerFd_ = timerfd_create(CLOCK_REALTIME, TFD_NONBLOCK | TFD_CLOEXEC);
+
+    if (epollFd_ < 0 || notifyFd_ < 0 || (secondTicks_ && timerFd_ < 0)) {
+        const std::string error {std::strerror(errno)};
+        closeAll();
+        throw std::runtime_error("Unable to create the event loop file descriptors : " + error);
+    }
+
+    try {
+        watch(notifyFd_);
+        if (secondTicks_) {
+            armTimer();
+            watch(timerFd_);
+        }
+    } catch (...) {
+        closeAll();
+        throw;
+    }
+}
+
+EventLoop::~EventLoop() {
+    closeAll();
+}
+
+void EventLoop::watch(int fd) {
+    epoll_event event {};
+    event.events = EPOLLIN;
+    event.data.fd = fd;
+
+    if (epoll_ctl(epollFd_, EPOLL_CTL_ADD, fd, &event) < 0) {
+        throw std::runtime_error("Unable to watch file descriptor " + std::to_string(fd) + " : " + std::strerror(errno));
+    }
+}
+
+void EventLoop::notify() {
+    const uint64_t one {1};
+    // write() is async-signal-safe; it can only fail if the counter overflows, the loop is woken up anyway
+    [[maybe_unused]] auto written = ::write(notifyFd_, &one, sizeof(one));
+}
+
+void EventLoop::wait(std::optional<TimePoint> deadline) {
+    int timeoutMs {-1};
+    if (deadline) {
+        // Rounded up, waking up before the deadline would only lead to another wait
+        const auto remaining = std::chrono::ceil<std::chrono::milliseconds>(*deadline - std::chrono::steady_clock::now());
+        timeoutMs = static_cast<int>(std::clamp<std::chrono::milliseconds::rep>(remaining.count(), 0, INT_MAX));
+    }
+
+    std::array<epoll_event, MAX_EVENTS> events {};
+    const int count = epoll_wait(epollFd_, events.data(), MAX_EVENTS, timeoutMs);
+    if (count < 0) {
+        if (errno == EINTR) return; // interrupted by a signal, the caller checks its state again
+        throw std::runtime_error("Error waiting for events : " + std::string(std::strerror(errno)));
+    }
+
+    for (int i {0}; i < count; ++i) {
+        const int fd = events[i].data.fd;
+        uint64_t counter {0};
+
+        if (fd == notifyFd_) {
+            [[maybe_unused]] auto readBytes = ::read(notifyFd_, &counter, sizeof(counter)); // reset the counter
+        } else if (fd == timerFd_) {
+            // ECANCELED: the wall clock was set, the second boundaries moved
+            if (::read(timerFd_, &counter, sizeof(counter)) < 0 && errno == ECANCELED) {
+                armTimer();
+            }
+        }
+        // watched file descriptors are read by their owner
+    }
+}
+
+void EventLoop::armTimer() const {
+    timespec now {};
+    clock_gettime(CLOCK_REALTIME, &now);
+
+    itimerspec spec {};
+    spec.it_value.tv_sec = now.tv_sec + 1; // next second boundary
+    spec.it_interval.tv_sec = 1;
+
+    if (timerfd_settime(timerFd_, TFD_TIMER_ABSTIME | TFD_TIMER_CANCEL_ON_SET, &spec, nullptr) < 0) {
+        throw std::runtime_error("Unable to set the second timer : " + std::string(std::strerror(errno)));
+    }
+}
+
+void EventLoop::closeAll() {
+    for (int* fd : {&epollFd_, &notifyFd_, &timerFd_}) {
+        if (*fd >= 0) ::close(*fd);
+        *fd = -1;
+    }
+}
+
+#else // __linux__
+
+EventLoop::EventLoop(bool secondTicks)
+    : secondTicks_{secondTicks}
+{}
+
+EventLoop::~EventLoop() = default;
+
+void EventLoop::notify() {
+    {
+        std::lock_guard lock{mutex_};
+        notified_ = true;
+    }
+    cv_.notify_one();
+}
+
+void EventLoop::wait(std::optional<TimePoint> deadline) {
+    using namespace std::chrono;
+
+    std::optional<TimePoint> wakeTime {deadline};
+
+    if (secondTicks_) {
+        // The next second boundary of the wall clock, expressed on the steady clock
+        const auto systemNow = system_clock::now();
+        const auto nextSecond = floor<seconds>(systemNow) + seconds{1};
+        const TimePoint secondTime = steady_clock::now() + duration_cast<steady_clock::duration>(nextSecond - systemNow);
+
+        wakeTime = wakeTime ? std::min(*wakeTime, secondTime) : secondTime;
+    }
+
+    std::unique_lock lock{mutex_};
+    if (wakeTime) {
+        cv_.wait_until(lock, *wakeTime, [this] { return notified_; });
+    } else {
+        cv_.wait(lock, [this] { return notified_; });
+    }
+    notified_ = false;
+}
+
+#endif // __linux__
+
+} // namespace PiAlarm::system
@@ -0,0 +1,114 @@
+#pragma once
+
+#include <chrono>
+#include <optional>
+
+#ifndef __linux__
+    #include <condition_variable>
+    #include <mutex>
+#endif
+
+#include "common/Observer.h"
+
+namespace PiAlarm::system {
+
+/**
+ * @brief Puts the main thread to sleep until there is work for it.
+ *
+ * The thread wakes up when:
+ * - a watched file descriptor becomes readable (e.g. the event fd of a button line),
+ * - a second boundary of the wall clock is reached, so the displayed time changes exactly on time (can be disabled),
+ * - notify() is called, typically by an observed model that changed (the loop is an Observer).
+ *
+ * On Linux, everything is waited on with a single epoll_wait: the second boundaries come from a timerfd
+ * and the notifications from an eventfd. Elsewhere, a condition variable is used and file descriptors cannot be watched.
+ */
+class EventLoop : public common::Observer {
+#ifdef __linux__
+    static constexpr int MAX_EVENTS {16}; ///< Maximum number of ready file descriptors handled per wake up
+
+    int epollFd_ {-1}; ///< The epoll instance waiting on every source
+    int timerFd_ {-1}; ///< Timer expiring on each second boundary of the wall clock
+    int notifyFd_ {-1}; ///< Event counter written by notify()
+#else
+    std::mutex mutex_; ///< Mutex guarding notified_
+    std::condition_variable cv_; ///< Signaled by notify()
+    bool notified_ {false}; ///< Whether notify() was called since the last wake up
+#endif
+    bool secondTicks_; ///< Whether the loop wakes up on each second boundary
+
+public:
+    using TimePoint = std::chrono::steady_clock::time_point; ///< Alias for the deadline type
+
+    /**
+     * @brief Creates the loop and arms the second timer.
+     * @param secondTicks Whether to wake up on each second boundary, a loop with nothing to do each second can skip it.
+     * @throws std::runtime_error if a file descriptor cannot be created.
+     */
+    explicit EventLoop(bool secondTicks = true);
+
+    /**
+     * @brief Closes the file descriptors of the loop. The watched ones are not closed.
+     */
+    ~EventLoop() override;
+
+    EventLoop(const EventLoop&) = delete; ///< No copy constructor
+    EventLoop& operator=(const EventLoop&) = delete; ///< No copy assignment operator
+
+#ifdef __linux__
+
+    /**
+     * @brief Wakes the loop up whenever a file descriptor is readable.
+     * The loop does not read it: the owner must consume the data once woken up, or the loop wakes up again immediately.
+     * @param fd The file descriptor to watch, it must stay open as long as the loop waits.
+     * @throws std::runtime_error if the file descriptor cannot be watched.
+     */
+    void watch(int fd);
+
+#endif // __linux__
+
+    /**
+     * @brief Wakes the loop up, or makes its next wait() return immediately.
+     * Can be called from any thread. On Linux, it is also async-signal-safe.
+     */
+    void notify();
+
+    /**
+     * @brief Blocks until a source is ready or the deadline is reached.
+     * The second timer and the notifications are consumed before returning.
+     * @param deadline The latest time to return at, no limit if empty.
+     * @throws std::runtime_error if waiting fails.
+     */
+    void wait(std::optional<TimePoint> deadline = std::nullopt);
+
+    /**
+     * @brief Called by an observed model when it changes, wakes the loop up.
+     */
+    inline void update() override;
+
+#ifdef __linux__
+
+private:
+
+    /**
+     * @brief Arms the timer on the next second boundary of the wall clock, then every second.
+     * The timer is cancelled if the wall clock is set, so it can be aligned again.
+     * @throws std::runtime_error if the timer cannot be set.
+     */
+    void armTimer() const;
+
+    /**
+     * @brief Closes the file descriptors opened by the loop.
+     */
+    void closeAll();
+
+#endif // __linux__
+};
+
+// Inline methods implementation
+
+inline void EventLoop::update() {
+    notify();
+}
+
+} // namespace PiAlarm::system
@@ -1,8 +1,10 @@
 #pragma once
 
+#include <array>
+#include <charconv>
+#include <memory_resource>
 #include <string>
-#include <sstream>
-#include <iomanip>
+#include <string_view>
 
 #include "WeatherUtils.hpp"
 #include "model/Time.h"
@@ -19,15 +21,22 @@ namespace PiAlarm::utils {
      * @param precision The number of decimal places to include.
      * @param unit The unit string to append after the value (e.g., "°C", "%").
      * @param placeholder The string to return if the value is not valid.
+     * @param memory The memory resource used to allocate the returned string (e.g. the frame arena of the views).
      * @return A formatted string representing the value with the specified precision and unit,
      *         or the placeholder if the value is invalid.
      */
-    inline std::string formatValue(float value, bool valid, int precision, const std::string& unit, const std::string& placeholder) {
-        if (!valid) return placeholder;
+    inline std::pmr::string formatValue(float value, bool valid, int precision, std::string_view unit, std::string_view placeholder,
+                                        std::pmr::memory_resource* memory = std::pmr::get_default_resource()) {
+        if (!valid) return std::pmr::string{placeholder, memory};
 
-        std::ostringstream oss;
-        oss << std::fixed << std::setprecision(precision) << value << unit;
-        return oss.str();
+        std::array<char, 64> digits; // NOLINT(cppcoreguidelines-pro-type-member-init)
+        auto [end, error] = std::to_chars(digits.data(), digits.data() + digits.size(), value, std::chars_format::fixed, precision);
+        if (error != std::errc{}) return std::pmr::string{placeholder, memory}; // value too large to be displayed
+
+        std::pmr::string formatted{memory};
+        formatted.reserve(static_cast<size_t>(end - digits.data()) + unit.size());
+        formatted.append(digits.data(), end).append(unit);
+        return formatted;
     }
 
     /**
@@ -40,11 +49,13 @@ namespace PiAlarm::utils {
      * @param valid Indicates whether the value is valid or not.
      * @param precision The number of decimal places to include.
      * @param placeholder The string to return if the value is not valid.
+     * @param memory The memory resource used to allocate the returned string.
      * @return A formatted string representing the value with the specified precision,
      *         or the placeholder if the value is invalid.
      */
-    inline std::string formatValue(float value, bool valid, int precision, const std::string& placeholder) {
-        return formatValue(value, valid, precision, "", placeholder);
+    inline std::pmr::string formatValue(float value, bool valid, int precision, std::string_view placeholder,
+                                        std::pmr::memory_resource* memory = std::pmr::get_default_resource()) {
+        return formatValue(value, valid, precision, "", placeholder, memory);
     }
 
     /**
@@ -56,10 +67,31 @@ namespace PiAlarm::utils {
      * @param time The model::Time object to format.
      * @param displayTime Indicates whether to display the time or return a placeholder.
      * @param includeSeconds Indicates whether to include seconds in the formatted time.
+     * @param memory The memory resource used to allocate the returned string.
      * @return A formatted string representing the time or a placeholder if not displaying time.
      */
-    inline std::string formatTime(model::Time time, bool displayTime = true, bool includeSeconds = false) {
-        return displayTime ? time.toString(includeSeconds) : includeSeconds ? "--:--:--" : "--:--";
+    inline std::pmr::string formatTime(model::Time time, bool displayTime = true, bool includeSeconds = false,
+                                       std::pmr::memory_resource* memory = std::pmr::get_default_resource()) {
+        if (!displayTime) return std::pmr::string{includeSeconds ? "--:--:--" : "--:--", memory};
+
+        // same format as model::Time::toString(), without a string stream
+        auto appendTwoDigits = [](std::pmr::string& str, int value) {
+            str.push_back(static_cast<char>('0' + value / 10 % 10));
+            str.push_back(static_cast<char>('0' + value % 10));
+        };
+
+        std::pmr::string formatted{memory};
+        formatted.reserve(includeSeconds ? 8 : 5);
+        appendTwoDigits(formatted, time.hour());
+        formatted.push_back(':');
+        appendTwoDigits(formatted, time.minute());
+
+        if (includeSeconds) {
+            formatted.push_back(':');
+            appendTwoDigits(formatted, time.second());
+        }
+
+        return formatted;
     }
 
     /**
@@ -70,10 +102,11 @@ namespace PiAlarm::utils {
      *
      * @param temperature The temperature value to format.
      * @param valid Indicates whether the temperature data is valid or not.
+     * @param memory The memory resource used to allocate the returned string.
      * @return A formatted string representing the temperature value or a placeholder if invalid.
      */
-    inline std::string formatTemperature(float temperature, bool valid) {
-        return formatValue(temperature, valid, 1, "°C", "--.-°C");
+    inline std::pmr::string formatTemperature(float temperature, bool valid, std::pmr::memory_resource* memory = std::pmr::get_default_resource()) {
+        return formatValue(temperature, valid, 1, "°C", "--.-°C", memory);
     }
 
     /**
@@ -84,10 +117,11 @@ namespace PiAlarm::utils {
      *
      * @param humidity The humidity value to format.
      * @param valid Indicates whether the humidity data is valid or not.
+     * @param memory The memory resource used to allocate the returned string.
      * @return A formatted string representing the humidity value or a placeholder if invalid.
      */
-    inline std::string formatHumidity(float humidity, bool valid) {
-        return formatValue(humidity, valid, 0, "%", "--%");
+    inline std::pmr::string formatHumidity(float humidity, bool valid, std::pmr::memory_resource* memory = std::pmr::get_default_resource()) {
+        return formatValue(humidity, valid, 0, "%", "--%", memory);
     }
 
     /**
@@ -98,10 +132,11 @@ namespace PiAlarm::utils {
      *
      * @param pressure The atmospheric pressure value to format.
      * @param valid Indicates whether the pressure data is valid or not.
+     * @param memory The memory resource used to allocate the returned string.
      * @return A formatted string representing the pressure value or a placeholder if invalid.
      */
-    inline std::string formatPressure(float pressure, bool valid) {
-        return formatValue(pressure, valid, 1, " hPa", "----.- hPa");
+    inline std::pmr::string formatPressure(float pressure, bool valid, std::pmr::memory_resource* memory = std::pmr::get_default_resource()) {
+        return formatValue(pressure, valid, 1, " hPa", "----.- hPa", memory);
     }
 
     /**
@@ -113,12 +148,14 @@ namespace PiAlarm::utils {
      * @param condition The weather condition to format.
      * @param valid Indicates whether the weather data is valid or not.
      * @param locale The locale for the weather condition string (default is "fr").
+     * @param memory The memory resource used to allocate the returned string.
      * @return A formatted string representing the weather condition or a placeholder if invalid.
      */
-    inline std::string formattedWeatherCondition(common::WeatherCondition condition, bool valid, const std::string& locale = "fr") {
-        if (!valid) return "???";
+    inline std::pmr::string formattedWeatherCondition(common::WeatherCondition condition, bool valid, const std::string& locale = "fr",
+                                                      std::pmr::memory_resource* memory = std::pmr::get_default_resource()) {
+        if (!valid) return std::pmr::string{"???", memory};
 
-        return getLocalizedWeatherCondition(condition, locale);
+        return std::pmr::string{getLocalizedWeatherCondition(condition, locale), memory};
     }
 
     /**
@@ -128,13 +165,20 @@ namespace PiAlarm::utils {
      * padding with leading zeros if necessary.
      *
      * @param value The integer value to format.
-     * @param minDigits The minimum number of digits in the formatted string.
+     * @param minDigits The minimum number of digits in the formatted string, including the sign.
+     * @param memory The memory resource used to allocate the returned string.
      * @return A string representation of the integer with leading zeros as needed.
      */
-    inline std::string formatInt(int value, int minDigits) {
-        std::ostringstream oss;
-        oss << std::setfill('0') << std::setw(minDigits) << value;
-        return oss.str();
+    inline std::pmr::string formatInt(int value, int minDigits, std::pmr::memory_resource* memory = std::pmr::get_default_resource()) {
+        std::array<char, 16> digits; // NOLINT(cppcoreguidelines-pro-type-member-init)
+        auto [end, error] = std::to_chars(digits.data(), digits.data() + digits.size(), value);
+        const auto length = static_cast<int>(end - digits.data());
+
+        std::pmr::string formatted{digits.data(), end, memory};
+        if (length < minDigits) {
+            formatted.insert(value < 0 ? 1 : 0, minDigits - length, '0'); // the padding goes after the sign
+        }
+        return formatted;
     }
 
 } // namespace PiAlarm::utils
\ No newline at end of file
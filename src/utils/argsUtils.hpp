@@ -32,6 +32,7 @@ namespace PiAlarm::utils {
                   << "  -a, --alarm-count <number>     Set the number of alarms (integer)\n"
                   << "  -l, --weaher-location <city>   Set the weather location (string)\n"
                   << "  -m, --music-dir <path>         Set the music folder path\n"
+                  << "  -r, --record-input <path>      Record the button events to a replayable script\n"
                   << "  -h, --help                     Show this help message\n";
     }
 
@@ -86,4 +87,21 @@ namespace PiAlarm::utils {
         return defaultValue;
     }
 
+    /**
+     * @brief Retrieves the path of the input record script from command line arguments.
+     * @param argc The argument count.
+     * @param argv The argument vector.
+     * @param defaultValue The default value to return if not specified.
+     * @return The script path specified or the default value.
+     */
+    inline std::string getInputRecordPath(int argc, char* argv[], const std::string& defaultValue) {
+        for (int i = 1; i < argc - 1; ++i) {
+            std::string arg = argv[i];
+            if (arg == "-r" || arg == "--record-input") {
+                return argv[i + 1];
+            }
+        }
+        return defaultValue;
+    }
+
 } // namespace PiAlarm::utils
\ No newline at end of file
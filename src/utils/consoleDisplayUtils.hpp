@@ -1,6 +1,6 @@
 #pragma once
 
-#include <string>
+#include <string_view>
 
 
 namespace PiAlarm::utils {
@@ -14,7 +14,7 @@ namespace PiAlarm::utils {
      * @param str The input string to count multibyte characters in.
      * @return The count of multibyte characters in the string.
      */
-    inline size_t countMultibyteChars(const std::string& str) {
+    inline size_t countMultibyteChars(std::string_view str) {
         size_t count = 0;
 
         for (size_t i = 0; i < str.size(); ) {
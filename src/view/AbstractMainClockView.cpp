@@ -16,19 +16,13 @@ namespace PiAlarm::view {
         currentWeatherData_{currentWeatherData},
         currentIndoorData_{temperatureSensorData}
     {
-        alarmsData_.addObserver(this);
-        alarmStateData_.addObserver(this);
-        clockData_.addObserver(this);
-        currentWeatherData_.addObserver(this);
-        currentIndoorData_.addObserver(this);
-    }
-
-    AbstractMainClockView::~AbstractMainClockView() {
-        alarmsData_.removeObserver(this);
-        alarmStateData_.removeObserver(this);
-        clockData_.removeObserver(this);
-        currentWeatherData_.removeObserver(this);
-        currentIndoorData_.removeObserver(this);
+        // The clock ticks every second and the sensors change several values at once,
+        // comparing generations once per frame refreshes the view once for all of them
+        watch(alarmsData_);
+        watch(alarmStateData_);
+        watch(clockData_);
+        watch(currentWeatherData_);
+        watch(currentIndoorData_);
     }
 
     void AbstractMainClockView::refresh() {
@@ -39,15 +33,18 @@ namespace PiAlarm::view {
         const auto nextAlarm {alarmsData_.getNextAlarm(currentTime_)};
         nextAlarmTime_ = nextAlarm ? nextAlarm->getTime() : model::Time(0);
 
-        currentIndoorTemperature_ = currentIndoorData_.getTemperature();
-        currentIndoorHumidity_ = currentIndoorData_.getHumidity();
-        indoorDataValid_ = currentIndoorData_.isValid();
+        // One snapshot per model: the displayed values always come from the same measurement
+        const model::IndoorValues indoor {currentIndoorData_.snapshot()};
+        currentIndoorTemperature_ = indoor.temperature;
+        currentIndoorHumidity_ = indoor.humidity;
+        indoorDataValid_ = indoor.valid;
 
-        currentOutdoorTemperature_ = currentWeatherData_.getTemperature();
-        currentOutdoorHumidity_ = currentWeatherData_.getHumidity();
-        currentOutdoorPressure_ = currentWeatherData_.getPressure();
-        currentWeatherCondition_ = currentWeatherData_.getCondition();
-        currentWeatherDataValid_ = currentWeatherData_.isValid();
+        const model::WeatherValues weather {currentWeatherData_.snapshot()};
+        currentOutdoorTemperature_ = weather.temperature;
+        currentOutdoorHumidity_ = weather.humidity;
+        currentOutdoorPressure_ = weather.pressure;
+        currentWeatherCondition_ = weather.condition;
+        currentWeatherDataValid_ = weather.valid;
     }
     
 } // namespace PiAlarm::view
@@ -15,6 +15,7 @@ namespace PiAlarm::view {
      *
      * This class provides a base implementation for the main clock view, which displays the current time,
      * alarm information, and weather data.
+     * The data models are watched, so the view is refreshed at most once per frame whatever the number of changes.
      */
     class AbstractMainClockView : public AbstractObserverView {
     protected:
@@ -59,12 +60,6 @@ namespace PiAlarm::view {
             const model::CurrentIndoorData& temperatureSensorData
         );
 
-        /**
-         * @brief Destructor for AbstractMainClockView.
-         * Cleans up resources and stops observing the data models.
-         */
-        ~AbstractMainClockView() override;
-
         // Inherited from IView
 
         /**
@@ -78,8 +73,9 @@ namespace PiAlarm::view {
          * alarm information, and weather data.
          *
          * @param renderer The renderer to use for displaying the view.
+         * @param frameMemory The memory resource to allocate the render temporaries from.
          */
-        virtual void render(RenderType& renderer) const override = 0;
+        virtual void render(RenderType& renderer, std::pmr::memory_resource* frameMemory) const override = 0;
     };
 
 } // namespace PiAlarm::view
\ No newline at end of file
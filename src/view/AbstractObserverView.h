@@ -1,8 +1,11 @@
 #pragma once
 
 #include <atomic>
+#include <cstdint>
+#include <vector>
 
 #include "IView.h"
+#include "common/Observable.hpp"
 #include "common/Observer.h"
 
 namespace PiAlarm::view {
@@ -15,10 +18,25 @@ namespace PiAlarm::view {
      * It provides a mechanism to mark the view as dirty when the model changes,
      * indicating that the view needs to be refreshed.
      *
+     * Models can also be watched instead of observed: the view remembers the generation of each of them
+     * when it is cleared, and is dirty as long as one has moved since. Any number of changes between two frames
+     * then costs a single refresh, and the model threads never reach the view.
+     *
      * @note Still needs to implement the refresh() and render() methods in derived classes.
      */
     class AbstractObserverView : public IView, public common::Observer {
+
+        /**
+         * @struct WatchedModel
+         * @brief A watched model and the generation displayed by the view.
+         */
+        struct WatchedModel {
+            const common::Observable* model; ///< The watched model
+            uint64_t seenGeneration; ///< Generation of the model when the view was last cleared
+        };
+
         std::atomic<bool> dirty_; ///< Flag indicating if the view is dirty (needs to be refreshed)
+        std::vector<WatchedModel> watchedModels_; ///< Models compared at each frame
 
     public:
 
@@ -40,7 +58,7 @@ namespace PiAlarm::view {
         // Inherited from IView
         // Still needs to be implemented by derived classes.
         virtual void refresh() override = 0;
-        virtual void render(RenderType& renderer) const override = 0;
+        virtual void render(RenderType& renderer, std::pmr::memory_resource* frameMemory) const override = 0;
 
         // Inherited from IView
         // Is implemented here to avoid code duplication in derived classes.
@@ -58,20 +76,44 @@ namespace PiAlarm::view {
             // Default implementation does nothing, can be overridden in derived classes
         }
 
+    protected:
+
+        /**
+         * Watches a model: the view becomes dirty when the generation of the model changes.
+         * Unlike an observer, nothing has to be removed when the view is destroyed.
+         * @param model The model to watch, it must outlive the view.
+         */
+        inline void watch(const common::Observable& model);
+
     };
 
     // inline methods implementation
 
     inline bool AbstractObserverView::isDirty() const {
-        return dirty_.load();
+        if (dirty_.load()) return true;
+
+        for (const WatchedModel& watched : watchedModels_) {
+            if (watched.model->getGeneration() != watched.seenGeneration) return true;
+        }
+        return false;
     }
 
     inline void AbstractObserverView::clearDirty() {
         dirty_.store(false);
+
+        // The changes made after this point are refreshed at the next frame
+        for (WatchedModel& watched : watchedModels_) {
+            watched.seenGeneration = watched.model->getGeneration();
+        }
     }
 
     inline void AbstractObserverView::update() {
         dirty_.store(true); // The model has changed, the view needs to be refreshed
     }
 
+    inline void AbstractObserverView::watch(const common::Observable& model) {
+        watchedModels_.push_back({&model, model.getGeneration()});
+        dirty_.store(true); // Show the current state of the model
+    }
+
 } // namespace PiAlarm::view
\ No newline at end of file
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <memory_resource>
+
 #include "display/ViewOutputConfig.h"
 #include "input/HasInputEventHandler.h"
 
@@ -36,8 +38,10 @@ namespace PiAlarm::view {
          * Renders the view using the provided renderer.
          * This method should be implemented to draw the view's content on the screen.
          * @param renderer The renderer used to draw the view.
+         * @param frameMemory The memory resource to allocate the render temporaries from (strings, lists...).
+         *                    It is reset once the frame has been flushed, nothing allocated from it may be kept.
          */
-        virtual void render(RenderType& renderer) const = 0;
+        virtual void render(RenderType& renderer, std::pmr::memory_resource* frameMemory) const = 0;
 
         /**
          * Checks if the view has undisplayed changes.
@@ -49,6 +53,7 @@ namespace PiAlarm::view {
 
         /**
          * Clears the dirty state of the view.
+         * It is called before refresh(), so a change made during the refresh keeps the view dirty.
          */
         virtual void clearDirty() = 0;
 
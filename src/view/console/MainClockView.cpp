@@ -24,27 +24,29 @@ namespace PiAlarm::view::console {
         )
         {}
 
-    void MainClockView::render(RenderType& renderer) const {
-        std::vector<std::pair<std::string, std::string>> labels = {
-            { "Heure actuelle", utils::formatTime(currentTime_, true, true) },
-            { "Etat de l'alarme", getAlarmStatus() },
-            { "Nombre d'alarmes actives", std::to_string(enabledAlarmCount_) },
-            { "", "" },
-
-            { "Température pièce", utils::formatTemperature(currentIndoorTemperature_, indoorDataValid_) },
-            { "Humidité pièce", utils::formatHumidity(currentIndoorHumidity_, indoorDataValid_) },
-            { "", "" },
-
-            { "Température ext.", utils::formatTemperature(currentOutdoorTemperature_, currentWeatherDataValid_) },
-            { "Humidité ext.", utils::formatHumidity(currentOutdoorHumidity_, currentWeatherDataValid_) },
-            { "Pression atm.", utils::formatPressure(currentOutdoorPressure_, currentWeatherDataValid_) },
-            { "Condition météo", utils::formattedWeatherCondition(currentWeatherCondition_, currentWeatherDataValid_) }
-        };
+    void MainClockView::render(RenderType& renderer, std::pmr::memory_resource* frameMemory) const {
+        const std::pmr::string empty{frameMemory};
+
+        Labels labels{{
+            { "Heure actuelle", utils::formatTime(currentTime_, true, true, frameMemory) },
+            { "Etat de l'alarme", getAlarmStatus(frameMemory) },
+            { "Nombre d'alarmes actives", utils::formatInt(static_cast<int>(enabledAlarmCount_), 1, frameMemory) },
+            { "", empty },
+
+            { "Température pièce", utils::formatTemperature(currentIndoorTemperature_, indoorDataValid_, frameMemory) },
+            { "Humidité pièce", utils::formatHumidity(currentIndoorHumidity_, indoorDataValid_, frameMemory) },
+            { "", empty },
+
+            { "Température ext.", utils::formatTemperature(currentOutdoorTemperature_, currentWeatherDataValid_, frameMemory) },
+            { "Humidité ext.", utils::formatHumidity(currentOutdoorHumidity_, currentWeatherDataValid_, frameMemory) },
+            { "Pression atm.", utils::formatPressure(currentOutdoorPressure_, currentWeatherDataValid_, frameMemory) },
+            { "Condition météo", utils::formattedWeatherCondition(currentWeatherCondition_, currentWeatherDataValid_, "fr", frameMemory) }
+        }, frameMemory};
 
         displayLabels(renderer,labels);
     }
 
-    void MainClockView::displayLabels(RenderType& renderer, const std::vector<std::pair<std::string, std::string>>& labels) const {
+    void MainClockView::displayLabels(RenderType& renderer, const Labels& labels) const {
         size_t max_len = 0;
         for (const auto &label: labels | std::views::keys) {
 
@@ -70,20 +72,26 @@ namespace PiAlarm::view::console {
         }
     }
 
-    std::string MainClockView::getAlarmStatus() const {
+    std::pmr::string MainClockView::getAlarmStatus(std::pmr::memory_resource* memory) const {
         if (!hasAlarmEnabled_)
-            return "Aucune alarme activée";
+            return {"Aucune alarme activée", memory};
 
-        if (!alarmStateData_.hasTriggeredAlarm())
-            return "Prochaine alarme à " + nextAlarmTime_.toString();
+        if (!alarmStateData_.hasTriggeredAlarm()) {
+            std::pmr::string status{"Prochaine alarme à ", memory};
+            status.append(utils::formatTime(nextAlarmTime_, true, true, memory));
+            return status;
+        }
 
         if (alarmStateData_.isAlarmRinging())
-            return "Alarme en cours";
+            return {"Alarme en cours", memory};
 
-        if (alarmStateData_.isAlarmSnoozed())
-            return "Alarme en pause jusqu'à " + alarmStateData_.getSnoozeUntil()->toString();
+        if (alarmStateData_.isAlarmSnoozed()) {
+            std::pmr::string status{"Alarme en pause jusqu'à ", memory};
+            status.append(utils::formatTime(*alarmStateData_.getSnoozeUntil(), true, true, memory));
+            return status;
+        }
 
-        return "???";
+        return {"???", memory};
     }
 
 } // namespace PiAlarm::view::console
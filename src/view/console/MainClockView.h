@@ -1,6 +1,8 @@
 #pragma once
 
+#include <memory_resource>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <utility>
 
@@ -50,10 +52,12 @@ namespace PiAlarm::view::console {
          * @brief Renders the view using the provided renderer.
          * This method displays the current time, alarm status, and weather information in the console.
          * @param renderer The renderer used to output the view.
+         * @param frameMemory The memory resource to allocate the render temporaries from.
          */
-        void render(RenderType& renderer) const override;
+        void render(RenderType& renderer, std::pmr::memory_resource* frameMemory) const override;
 
     private:
+        using Labels = std::pmr::vector<std::pair<std::string_view, std::pmr::string>>; ///< Label names and their values
 
         /**
          * @brief Displays labels and their corresponding values.
@@ -61,15 +65,16 @@ namespace PiAlarm::view::console {
          * @param renderer The renderer used to output the labels.
          * @param labels A vector of pairs containing label names and their corresponding values.
          */
-        void displayLabels(RenderType& renderer, const std::vector<std::pair<std::string, std::string>>& labels) const;
+        void displayLabels(RenderType& renderer, const Labels& labels) const;
 
         /**
          * @brief Gets the current alarm status.
          * This method checks if there is an enabled alarm and returns a string representation of the alarm status.
+         * @param memory The memory resource used to allocate the returned string.
          * @return A string indicating the current alarm status.
          */
         [[nodiscard]]
-        std::string getAlarmStatus() const;
+        std::pmr::string getAlarmStatus(std::pmr::memory_resource* memory) const;
     };
 
 } // namespace PiAlarm::view::console
\ No newline at end of file
@@ -0,0 +1,102 @@
+#ifdef DISPLAY_SSD1322
+
+#include <algorithm>
+#include <cassert>
+#include <utility>
+
+#include "DisplayWorker.h"
+#include "gfx/RegionSet.h"
+
+namespace PiAlarm::view {
+
+    DisplayWorker::DisplayWorker(ScreenType& screen, common::InputLatencyTracer& inputLatency)
+        : HasWorker{"DisplayWorker"}, screen_{screen}, inputLatency_{inputLatency}
+    {
+        setWorkerCycleBudget(std::chrono::milliseconds::zero()); // workerProcess() waits for the next frame
+    }
+
+    DisplayWorker::~DisplayWorker() {
+        stop(); // before the members used by the worker thread are destroyed
+    }
+
+    void DisplayWorker::submit(const uint8_t* pixels, size_t size, const gfx::Rect& region,
+                               std::optional<common::InputLatencyTracer::TimePoint> inputTime) {
+        assert(size == FRAME_SIZE);
+
+        // The write slot belongs to the UI thread, fill it without holding the lock
+        Frame& frame = pool_[writeIndex_];
+        std::copy_n(pixels, std::min(size, FRAME_SIZE), frame.pixels.begin());
+        frame.region = region;
+        frame.inputTime = inputTime;
+
+        {
+            std::lock_guard lock{mutex_};
+
+            if (frameReady_) {
+                // The previous frame was not taken yet: it is replaced, its changes are sent with this one
+                const Frame& replaced = pool_[readyIndex_];
+                frame.region = gfx::RegionSet::unite(frame.region, replaced.region);
+                if (replaced.inputTime && (!frame.inputTime || *replaced.inputTime < *frame.inputTime)) {
+                    frame.inputTime = replaced.inputTime; // its input is displayed by this frame
+                }
+                ++replacedFrames_;
+            }
+
+            std::swap(writeIndex_, readyIndex_);
+            frameReady_ = true;
+        }
+        frameCv_.notify_one();
+    }
+
+    void DisplayWorker::stop() {
+        {
+            std::lock_guard lock{mutex_};
+            stopping_ = true;
+        }
+        frameCv_.notify_all();
+
+        stopWorker();
+    }
+
+    bool DisplayWorker::onWorkerStart() {
+        std::lock_guard lock{mutex_};
+        stopping_ = false;
+        return true;
+    }
+
+    void DisplayWorker::workerProcess() {
+        {
+            std::unique_lock lock{mutex_};
+            frameCv_.wait_for(lock, FRAME_WAIT_TIMEOUT, [this] { return frameReady_ || stopping_; });
+
+            if (!frameReady_ || stopping_) return;
+
+            // Take the last completed frame, the slot flushed before becomes the ready one
+            std::swap(flushIndex_, readyIndex_);
+            frameReady_ = false;
+        }
+
+        const Frame& frame = pool_[flushIndex_];
+        gfx::Rect region = frame.region;
+
+        if (resendAll_) {
+            // The changes of the frame whose flush failed are not all in this region
+            region = {0, 0, gfx::SDD1322Buffer::BUFFER_PIXEL_WIDTH, gfx::SDD1322Buffer::BUFFER_PIXEL_HEIGHT};
+        }
+
+        resendAll_ = true; // until the flush succeeds
+        screen_.flushRegion(frame.pixels.data(), frame.pixels.size(), region.x, region.y, region.width, region.height);
+        resendAll_ = false;
+
+        if (frame.inputTime) inputLatency_.record(common::InputLatencyTracer::Stage::Displayed, *frame.inputTime);
+
+        ++flushedFrames_;
+    }
+
+    void DisplayWorker::onWorkerStop() {
+        logger().info("Frames flushed: {}, replaced before being flushed: {}", flushedFrames_.load(), replacedFrames_.load());
+    }
+
+} // namespace PiAlarm::view
+
+#endif // DISPLAY_SSD1322
@@ -0,0 +1,151 @@
+#pragma once
+
+#ifdef DISPLAY_SSD1322
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+
+#include "common/HasWorker.h"
+#include "common/InputLatencyTracer.h"
+#include "display/ViewOutputConfig.h"
+#include "gfx/Rect.h"
+
+namespace PiAlarm::view {
+
+    /**
+     * @class DisplayWorker
+     * @brief Sends the rendered frames to the screen from a dedicated thread.
+     *
+     * The UI thread submits each completed frame with the region that changed, and goes on rendering
+     * while the worker pushes the frame over SPI. Frames go through a pool of three slots:
+     * one written by the UI thread, one holding the last completed frame, and one being flushed.
+     * Submitting never waits for a flush: if the previous frame was not taken yet, it is replaced
+     * and its region is added to the new one, so the screen still receives every change.
+     */
+    class DisplayWorker final : public common::HasWorker {
+    public:
+        static constexpr size_t FRAME_SIZE {
+            gfx::SDD1322Buffer::BUFFER_PIXEL_WIDTH * gfx::SDD1322Buffer::BUFFER_PIXEL_HEIGHT / 2
+        }; ///< Size of a packed frame in bytes (4 bits per pixel)
+
+    private:
+
+        /**
+         * @struct Frame
+         * @brief A slot of the pool: a copy of a rendered frame and the region to send.
+         */
+        struct Frame {
+            std::array<uint8_t, FRAME_SIZE> pixels {}; ///< Packed pixels of the frame
+            gfx::Rect region {}; ///< Region that changed since the previous submitted frame
+            std::optional<common::InputLatencyTracer::TimePoint> inputTime {}; ///< Edge time of the oldest input shown by the frame
+        };
+
+        static constexpr size_t POOL_SIZE {3}; ///< Number of frame slots (triple buffering)
+        static constexpr std::chrono::milliseconds FRAME_WAIT_TIMEOUT {100}; ///< Longest wait for a frame before checking the worker state again
+
+        ScreenType& screen_; ///< The screen the frames are sent to, only used by the worker thread once started
+        common::InputLatencyTracer& inputLatency_; ///< Records when the frames showing an input are displayed
+
+        std::array<Frame, POOL_SIZE> pool_ {}; ///< Frame slots
+        size_t writeIndex_ {0}; ///< Slot filled by submit(), owned by the UI thread
+        size_t readyIndex_ {1}; ///< Slot holding the last completed frame, guarded by mutex_
+        size_t flushIndex_ {2}; ///< Slot being flushed, owned by the worker thread
+        bool frameReady_ {false}; ///< Whether the ready slot holds a frame not flushed yet, guarded by mutex_
+        bool stopping_ {false}; ///< Whether stop() was called, guarded by mutex_
+        bool resendAll_ {false}; ///< Whether a flush failed, so the next one must send the whole frame
+
+        std::mutex mutex_; ///< Mutex guarding the exchange of the slots
+        std::condition_variable frameCv_; ///< Signaled when a frame is submitted or the worker is stopping
+
+        std::atomic<size_t> flushedFrames_ {0}; ///< Number of frames sent to the screen
+        std::atomic<size_t> replacedFrames_ {0}; ///< Number of frames replaced by a newer one before being sent
+
+    public:
+
+        /**
+         * @brief Constructs a DisplayWorker sending frames to the given screen.
+         * @param screen The screen, already initialized when the worker is started.
+         * @param inputLatency Tracer recording when the frames showing an input are flushed.
+         */
+        DisplayWorker(ScreenType& screen, common::InputLatencyTracer& inputLatency);
+
+        /**
+         * @brief Destructor, stops the worker thread.
+         */
+        ~DisplayWorker() override;
+
+        /**
+         * @brief Hands a rendered frame over to the worker.
+         * The frame is copied, the buffer can be drawn again as soon as this returns.
+         * Must be called from a single thread.
+         * @param pixels Pointer to the packed frame.
+         * @param size The size of the frame in bytes, FRAME_SIZE.
+         * @param region The region that changed since the previously submitted frame, not empty.
+         * @param inputTime Edge time of the oldest input the frame shows the result of, if any.
+         */
+        void submit(const uint8_t* pixels, size_t size, const gfx::Rect& region,
+                    std::optional<common::InputLatencyTracer::TimePoint> inputTime = std::nullopt);
+
+        /**
+         * @brief Stops the worker thread without waiting for the frame wait timeout.
+         * A frame being flushed is finished, a frame still waiting is not sent.
+         */
+        void stop();
+
+        /**
+         * @brief Gets the number of frames sent to the screen.
+         * @return The number of flushed frames.
+         */
+        [[nodiscard]]
+        inline size_t getFlushedFrames() const;
+
+        /**
+         * @brief Gets the number of frames replaced by a newer one before being sent.
+         * Their changes were sent with the newer frame.
+         * @return The number of replaced frames.
+         */
+        [[nodiscard]]
+        inline size_t getReplacedFrames() const;
+
+    protected:
+
+        /**
+         * @brief Clears the stop request of a previous run.
+         * @return Always true.
+         */
+        bool onWorkerStart() override;
+
+        /**
+         * @brief Waits for a submitted frame and sends it to the screen.
+         */
+        void workerProcess() override;
+
+        /**
+         * @brief Does not wait, workerProcess() already waits for the next frame.
+         */
+        void workerWaitNextCycle() override {}
+
+        /**
+         * @brief Logs the frame counters.
+         */
+        void onWorkerStop() override;
+    };
+
+    // Inline methods implementation
+
+    inline size_t DisplayWorker::getFlushedFrames() const {
+        return flushedFrames_.load();
+    }
+
+    inline size_t DisplayWorker::getReplacedFrames() const {
+        return replacedFrames_.load();
+    }
+
+} // namespace PiAlarm::view
+
+#endif // DISPLAY_SSD1322
@@ -0,0 +1,111 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <memory_resource>
+
+namespace PiAlarm::view {
+
+    /**
+     * @class FrameArena
+     * @brief Monotonic memory resource for the temporaries of a single frame.
+     *
+     * Views allocate their render temporaries (formatted strings, label lists...) from this arena
+     * through std::pmr containers. Allocations only bump a pointer in a fixed buffer and deallocations are no-ops;
+     * the whole arena is reset once the frame has been flushed, so rendering does no malloc/free
+     * and does not fragment the heap of a long-running process.
+     *
+     * If a frame needs more than the fixed buffer, the arena falls back to the default heap for the rest
+     * of the frame. Such frames are counted, so the capacity can be adjusted.
+     *
+     * @note This class is not thread-safe, it is intended to be used by the render loop only.
+     */
+    class FrameArena {
+    public:
+        static constexpr size_t CAPACITY {4096}; ///< Size in bytes of the fixed buffer
+
+    private:
+
+        /**
+         * @class CountingResource
+         * @brief Upstream resource of the arena, forwards to the heap and counts the allocations.
+         */
+        class CountingResource : public std::pmr::memory_resource {
+            size_t allocationCount_ {0}; ///< Number of allocations forwarded to the heap
+
+        public:
+            [[nodiscard]]
+            inline size_t getAllocationCount() const {
+                return allocationCount_;
+            }
+
+        private:
+            void* do_allocate(size_t bytes, size_t alignment) override {
+                ++allocationCount_;
+                return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+            }
+
+            void do_deallocate(void* p, size_t bytes, size_t alignment) override {
+                std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+            }
+
+            [[nodiscard]]
+            bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+                return this == &other;
+            }
+        };
+
+        alignas(std::max_align_t) std::array<std::byte, CAPACITY> buffer_; ///< Fixed storage, reused by every frame
+        CountingResource upstream_; ///< Heap fallback used when a frame does not fit in the buffer
+        std::pmr::monotonic_buffer_resource resource_; ///< Bump allocator over the buffer
+
+    public:
+
+        /**
+         * @brief Constructs an empty arena.
+         */
+        inline FrameArena();
+
+        FrameArena(const FrameArena&) = delete;
+        FrameArena& operator=(const FrameArena&) = delete;
+
+        /**
+         * @brief Gets the memory resource to allocate the frame temporaries from.
+         * @return A pointer to the arena resource, valid for the lifetime of the arena.
+         */
+        [[nodiscard]]
+        inline std::pmr::memory_resource* resource();
+
+        /**
+         * @brief Releases everything allocated during the frame.
+         * Every object allocated from the arena must have been destroyed before.
+         */
+        inline void reset();
+
+        /**
+         * @brief Gets the number of allocations that did not fit in the fixed buffer.
+         * @return The number of heap allocations made by the arena since its creation.
+         */
+        [[nodiscard]]
+        inline size_t getOverflowCount() const;
+    };
+
+    // Inline methods implementation
+
+    inline FrameArena::FrameArena()
+        : buffer_{}, upstream_{}, resource_{buffer_.data(), buffer_.size(), &upstream_}
+    {}
+
+    inline std::pmr::memory_resource* FrameArena::resource() {
+        return &resource_;
+    }
+
+    inline void FrameArena::reset() {
+        resource_.release(); // back to the start of the fixed buffer
+    }
+
+    inline size_t FrameArena::getOverflowCount() const {
+        return upstream_.getAllocationCount();
+    }
+
+} // namespace PiAlarm::view
@@ -3,9 +3,29 @@
 
 namespace PiAlarm::view {
 
-    ViewManager::ViewManager(ScreenType& screen, RenderType& renderer)
-        : screen_{screen}, renderer_{renderer}
-    {}
+    ViewManager::ViewManager(ScreenType& screen, RenderType& renderer, common::InputLatencyTracer& inputLatency)
+        : screen_{screen}, renderer_{renderer}, inputLatency_{inputLatency}
+#ifdef DISPLAY_SSD1322
+        , displayWorker_{screen, inputLatency}
+#endif
+    {
+#ifdef DISPLAY_SSD1322
+        // Views are recorded, then only what changed since the previous frame is rasterized
+        renderer_.setRecording(true);
+#endif
+    }
+
+    void ViewManager::start() {
+#ifdef DISPLAY_SSD1322
+        displayWorker_.startWorker();
+#endif
+    }
+
+    void ViewManager::stop() {
+#ifdef DISPLAY_SSD1322
+        displayWorker_.stop();
+#endif
+    }
 
     void ViewManager::addView(std::unique_ptr<IView> view) {
         views_.push_back(std::move(view));
@@ -30,6 +50,9 @@ namespace PiAlarm::view {
     }
 
     void ViewManager::refresh() {
+        // Only this refresh may show the result of the inputs handled before it
+        const auto inputTime = std::exchange(pendingInput_, std::nullopt);
+
         if (!hasValidActiveView()) {
             return;
         }
@@ -47,17 +70,30 @@ namespace PiAlarm::view {
                 #endif // DISPLAY_SSD1322
             }
 
-            activeView->refresh();
-            activeView->render(renderer_);
+            // Cleared first: a change made while the view reads the models is shown by the next frame
             activeView->clearDirty();
+            activeView->refresh();
+            activeView->render(renderer_, frameArena_.resource());
+
+            #ifdef DISPLAY_SSD1322
+                renderer_.replay(); // Rasterize the regions that differ from the previous frame
+            #endif // DISPLAY_SSD1322
 
-            flushDisplay(); // Flush the display to show the rendered view
+            if (inputTime) inputLatency_.record(common::InputLatencyTracer::Stage::Rendered, *inputTime);
+
+            flushDisplay(inputTime); // Flush the display to show the rendered view
+            frameArena_.reset(); // The render temporaries are gone, reuse their memory for the next frame
         }
     }
 
     void ViewManager::handleInputEvent(const input::InputEvent &event) {
+        inputLatency_.record(common::InputLatencyTracer::Stage::ViewHandled, event.timestamp);
+
         if (!event.pressed) return;
 
+        // The next refresh shows the result of the press
+        if (!pendingInput_ || event.timestamp < *pendingInput_) pendingInput_ = event.timestamp;
+
         if (viewInControl_) {
             if (event.button == input::ButtonId::Back) {
                 viewInControl_ = false; // Exit view control mode
@@ -1,11 +1,18 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <vector>
 
+#include "common/InputLatencyTracer.h"
 #include "display/ViewOutputConfig.h"
 #include "input/HasInputEventHandler.h"
 #include "view/IView.h"
+#include "FrameArena.h"
+
+#ifdef DISPLAY_SSD1322
+    #include "DisplayWorker.h"
+#endif
 
 namespace PiAlarm::view {
 
@@ -22,17 +29,35 @@ namespace PiAlarm::view {
      * @note The Back button (input::ButtonId::Back) is used to exit view control mode. Not available inside the view control mode.
      */
     class ViewManager : public input::HasInputEventHandler {
+    public:
+
+        /**
+         * @struct FlushStats
+         * @brief Counters describing how the rendered frames reached the screen.
+         */
+        struct FlushStats {
+            size_t flushed {0}; ///< Number of frames sent to the screen
+            size_t skipped {0}; ///< Number of frames not sent because they were identical to the displayed one
+        };
+
+    private:
 
         std::vector<std::unique_ptr<IView>> views_; ///< Owned views
         size_t currentViewIndex_ {0}; ///< Index of the active view
         bool viewInControl_ {false}; ///< Flag to indicate if the view is in control of the input
         bool forceRefresh_ {false}; ///< Flag to force refresh the current view at the next loop
+        FlushStats flushStats_; ///< Counters of sent and avoided flushes
+        FrameArena frameArena_; ///< Memory of the render temporaries, reset after each flush
 
         ScreenType& screen_; ///< Reference to the screen for rendering views
         RenderType& renderer_; ///< Reference to the renderer for drawing views
 
+        common::InputLatencyTracer& inputLatency_; ///< Records the latency of the inputs reaching the screen
+        std::optional<common::InputLatencyTracer::TimePoint> pendingInput_; ///< Edge time of the oldest input handled since the last refresh
+
 #ifdef DISPLAY_SSD1322
         const gfx::Pixel highlightBorderColor_ {0x30}; ///< Color used for highlighting the active view
+        DisplayWorker displayWorker_; ///< Thread sending the rendered frames to the screen
 #endif // DISPLAY_SSD1322
 
     public:
@@ -42,8 +67,22 @@ namespace PiAlarm::view {
          * Initializes the manager with a screen and renderer.
          * @param screen Reference to the screen where views will be rendered.
          * @param renderer Reference to the renderer used for drawing views.
+         * @param inputLatency Tracer recording when the handled inputs are rendered and displayed.
          */
-        ViewManager(ScreenType& screen, RenderType& renderer);
+        ViewManager(ScreenType& screen, RenderType& renderer, common::InputLatencyTracer& inputLatency);
+
+        /**
+         * Starts sending the rendered frames to the screen.
+         * With the SSD1322 display, frames are flushed by a dedicated thread, so rendering does not wait for SPI.
+         * The screen must be initialized before.
+         */
+        void start();
+
+        /**
+         * Stops sending the rendered frames to the screen.
+         * With the SSD1322 display, the flush thread is stopped and joined.
+         */
+        void stop();
 
         /**
          * Adds a view to the manager.
@@ -68,8 +107,10 @@ namespace PiAlarm::view {
 
         /**
          * Performs the refresh operation for the current view.
-         * Calls update and render if the view is dirty.
+         * Clears the view, then calls refresh and render, if the view is dirty.
+         * All the changes notified since the previous frame are refreshed and rendered once.
          * If no active view is set, this method does nothing.
+         * The inputs handled since the previous refresh are traced to the frame, if one is rendered.
          */
         void refresh();
 
@@ -81,6 +122,21 @@ namespace PiAlarm::view {
          */
         void handleInputEvent(const input::InputEvent& event) override;
 
+        /**
+         * Gets the number of flushes performed and avoided since the creation of the manager.
+         * A flush is avoided when a dirty view renders exactly the pixels already displayed.
+         * @return A reference to the flush counters.
+         */
+        [[nodiscard]]
+        inline const FlushStats& getFlushStats() const;
+
+        /**
+         * Gets the number of render allocations that did not fit in the frame arena and went to the heap.
+         * @return The number of overflowing allocations since the creation of the manager.
+         */
+        [[nodiscard]]
+        inline size_t getFrameArenaOverflowCount() const;
+
     private:
 
         /**
@@ -92,8 +148,11 @@ namespace PiAlarm::view {
         /**
          * Flushes the display to ensure all changes are rendered.
          * This method is called after rendering the current view.
+         * With the SSD1322 display, the frame is handed over to the display worker with the region
+         * that changed since the last flush, and the flush is skipped entirely if the frame is identical to the displayed one.
+         * @param inputTime Edge time of the oldest input the frame shows the result of, if any.
          */
-        inline void flushDisplay() const;
+        inline void flushDisplay(std::optional<common::InputLatencyTracer::TimePoint> inputTime);
 
         /**
          * Checks if the active view is valid.
@@ -117,15 +176,35 @@ namespace PiAlarm::view {
 #endif
     }
 
-    inline void ViewManager::flushDisplay() const {
+    inline void ViewManager::flushDisplay(std::optional<common::InputLatencyTracer::TimePoint> inputTime) {
 #ifdef DISPLAY_SSD1322
-        const gfx::IBuffer& buffer = renderer_.buffer();
-        screen_.flush(buffer.data(), buffer.size());
+        // Only send the part of the frame that changed since the last flush
+        auto& buffer = renderer_.buffer();
+        const gfx::Rect region = buffer.getDirtyRegion();
+
+        if (region.isEmpty()) {
+            ++flushStats_.skipped; // same pixels as the displayed frame
+            return;
+        }
+
+        displayWorker_.submit(buffer.data(), buffer.size(), region, inputTime); // the worker records when it is displayed
+        buffer.markFlushed();
 #elif defined(DISPLAY_CONSOLE)
         // screen is typically std::cout
         screen_ << renderer_.str();
         screen_ << std::flush;
+
+        if (inputTime) inputLatency_.record(common::InputLatencyTracer::Stage::Displayed, *inputTime);
 #endif
+        ++flushStats_.flushed;
+    }
+
+    inline const ViewManager::FlushStats& ViewManager::getFlushStats() const {
+        return flushStats_;
+    }
+
+    inline size_t ViewManager::getFrameArenaOverflowCount() const {
+        return frameArena_.getOverflowCount();
     }
 
     bool ViewManager::hasValidActiveView() const {
@@ -9,6 +9,7 @@ namespace PiAlarm::view::ssd1322 {
         alarmsData_{alarmsData},
         alarmController_{alarmController},
         dirty_{true},
+        seenAlarmsGeneration_{alarmsData.getGeneration()},
         alarmCount_{alarmsData.alarmCount()},
 
         // render attributes
@@ -25,12 +26,10 @@ namespace PiAlarm::view::ssd1322 {
             currentMinute_ = currentAlarmTime.minute();
             currentActivation_ = alarmsData_.getAlarm(currentSelectedAlarm_).isEnabled();
         }
-
-        dirty_ = true;
     }
 
-    void AlarmsSettingsView::render(RenderType &renderer) const {
-        drawAlarmIndex(renderer);
+    void AlarmsSettingsView::render(RenderType &renderer, std::pmr::memory_resource* frameMemory) const {
+        drawAlarmIndex(renderer, frameMemory);
 
         auto centerX = renderer.getWidth() / 2;
         auto centerY = renderer.getHeight() / 2;
@@ -38,33 +37,36 @@ namespace PiAlarm::view::ssd1322 {
             centerX, centerY + colonSeparatorOffsetY,
             ":",
             alarmTimeFont_,
-            gfx::Canvas::Anchor::Center
+            RenderType::Anchor::Center
         );
 
         auto digitSpacingFromCenter = colonSeparatorDimensions.width / 2 + digitColonSpacing_;
         auto digitBaseline = centerY + colonSeparatorDimensions.height / 2;
-        drawHour(renderer, centerX - digitSpacingFromCenter, digitBaseline);
-        drawMinute(renderer, centerX + digitSpacingFromCenter, digitBaseline);
+        drawHour(renderer, centerX - digitSpacingFromCenter, digitBaseline, frameMemory);
+        drawMinute(renderer, centerX + digitSpacingFromCenter, digitBaseline, frameMemory);
         drawActivation(renderer);
     }
 
-    void AlarmsSettingsView::drawAlarmIndex(RenderType &renderer) const {
+    void AlarmsSettingsView::drawAlarmIndex(RenderType &renderer, std::pmr::memory_resource* frameMemory) const {
         auto leftX = borderScreenVerticalSpacing_;
         auto topY = borderScreenVerticalSpacing_;
+        std::pmr::string indexText{"Alarme ", frameMemory};
+        indexText.append(utils::formatInt(static_cast<int>(currentSelectedAlarm_ + 1), 1, frameMemory));
+
         renderer.drawText(
             leftX, topY,
-            "Alarme " + std::to_string(currentSelectedAlarm_ + 1),
+            indexText,
             alarmIndexFont_,
-            gfx::Canvas::Anchor::TopLeft
+            RenderType::Anchor::TopLeft
         );
     }
 
-    void AlarmsSettingsView::drawHour(RenderType &renderer, size_t x, size_t baseline) const {
+    void AlarmsSettingsView::drawHour(RenderType &renderer, size_t x, size_t baseline, std::pmr::memory_resource* frameMemory) const {
         auto dimensions = renderer.drawText(
             x, baseline,
-            utils::formatInt(currentHour_, 2),
+            utils::formatInt(currentHour_, 2, frameMemory),
             alarmTimeFont_,
-            gfx::Canvas::Anchor::BottomRight
+            RenderType::Anchor::BottomRight
         );
 
         if (editState_.currentEdited == AlarmEditState::Part::Hour) {
@@ -76,12 +78,12 @@ namespace PiAlarm::view::ssd1322 {
         }
     }
 
-    void AlarmsSettingsView::drawMinute(RenderType &renderer, size_t x, size_t baseline) const {
+    void AlarmsSettingsView::drawMinute(RenderType &renderer, size_t x, size_t baseline, std::pmr::memory_resource* frameMemory) const {
         auto dimensions = renderer.drawText(
             x, baseline,
-            utils::formatInt(currentMinute_, 2),
+            utils::formatInt(currentMinute_, 2, frameMemory),
             alarmTimeFont_,
-            gfx::Canvas::Anchor::BottomLeft
+            RenderType::Anchor::BottomLeft
         );
 
         if (editState_.currentEdited == AlarmEditState::Part::Minute) {
@@ -96,9 +98,9 @@ namespace PiAlarm::view::ssd1322 {
         auto bottomY = renderer.getHeight() - borderScreenVerticalSpacing_;
         auto dimensions = renderer.drawText(
             centerX, bottomY,
-            std::string("Alarme ") + std::string(currentActivation_ ? "activée" : "désactivée"),
+            currentActivation_ ? "Alarme activée" : "Alarme désactivée",
             alarmActivationFont_,
-            gfx::Canvas::Anchor::BottomCenter
+            RenderType::Anchor::BottomCenter
         );
 
         if (editState_.currentEdited == AlarmEditState::Part::Activation) {
@@ -38,6 +38,7 @@ namespace PiAlarm::view::ssd1322 {
 
         // No need for dirty to be atomic here, as it is only accessed from the main thread (no update from observer)
         bool dirty_; ///< Flag indicating if the view is dirty (needs to be refreshed)
+        uint64_t seenAlarmsGeneration_; ///< Generation of the alarms data when the view was last cleared
 
         const size_t alarmCount_; ///< Number of alarms currently managed by the view
 
@@ -80,8 +81,9 @@ namespace PiAlarm::view::ssd1322 {
          * @brief Renders the alarms settings view.
          * This method draws the current state of the alarms on the display.
          * @param renderer The renderer to use for drawing the view.
+         * @param frameMemory The memory resource to allocate the render temporaries from.
          */
-        void render(RenderType &renderer) const override;
+        void render(RenderType &renderer, std::pmr::memory_resource* frameMemory) const override;
 
         /**
          * @brief Returns the type of the view.
@@ -141,8 +143,9 @@ namespace PiAlarm::view::ssd1322 {
          * @brief Draws the index of the currently selected alarm.
          * This method renders the index of the alarm being edited on the display.
          * @param renderer The renderer to use for drawing.
+         * @param frameMemory The memory resource to allocate the render temporaries from.
          */
-        void drawAlarmIndex(RenderType &renderer) const;
+        void drawAlarmIndex(RenderType &renderer, std::pmr::memory_resource* frameMemory) const;
 
         /**
          * @brief Draws the current alarm settings on the display.
@@ -150,8 +153,9 @@ namespace PiAlarm::view::ssd1322 {
          * @param renderer The renderer to use for drawing.
          * @param x The X coordinate for rendering the alarm settings.
          * @param baseline The baseline Y coordinate for rendering the alarm settings.
+         * @param frameMemory The memory resource to allocate the render temporaries from.
          */
-        void drawHour(RenderType &renderer, size_t x, size_t baseline) const;
+        void drawHour(RenderType &renderer, size_t x, size_t baseline, std::pmr::memory_resource* frameMemory) const;
 
         /**
          * @brief Draws the current minute settings on the display.
@@ -159,8 +163,9 @@ namespace PiAlarm::view::ssd1322 {
          * @param renderer The renderer to use for drawing.
          * @param x The X coordinate for rendering the minute settings.
          * @param baseline The baseline Y coordinate for rendering the minute settings.
+         * @param frameMemory The memory resource to allocate the render temporaries from.
          */
-        void drawMinute(RenderType &renderer, size_t x, size_t baseline) const;
+        void drawMinute(RenderType &renderer, size_t x, size_t baseline, std::pmr::memory_resource* frameMemory) const;
 
         /**
          * @brief Draws the activation status of the current alarm.
@@ -195,11 +200,12 @@ namespace PiAlarm::view::ssd1322 {
     // Inline methods implementation
 
     inline bool AlarmsSettingsView::isDirty() const {
-        return dirty_;
+        return dirty_ || alarmsData_.getGeneration() != seenAlarmsGeneration_; // e.g. an alarm changed by the controller
     }
 
     inline void AlarmsSettingsView::clearDirty() {
         dirty_ = false;
+        seenAlarmsGeneration_ = alarmsData_.getGeneration();
     }
 
 } // namespace PiAlarm::view::ssd1322
\ No newline at end of file
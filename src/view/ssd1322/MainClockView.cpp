@@ -22,66 +22,71 @@ namespace PiAlarm::view::ssd1322 {
         ),
         co2Data_{co2Data},
 
-        mainClockDigitFont_{gfx::TrueTypeFontCache::getFont(FONT_MozillaText_Light, 48)},
-        secondClockDigitFont_{gfx::TrueTypeFontCache::getFont(FONT_MozillaText_Light, 18)},
+        mainClockDigits_{gfx::TrueTypeFontCache::getFont(FONT_MozillaText_Light, 48)},
+        secondClockDigits_{gfx::TrueTypeFontCache::getFont(FONT_MozillaText_Light, 18)},
         rightListFont_{gfx::TrueTypeFontCache::getFont(FONT_MozillaText_Light, 13)},
         noAlarmFont_{gfx::TrueTypeFontCache::getFont(FONT_MozillaText_Light, 11)},
         snoozeUntilFont_{gfx::TrueTypeFontCache::getFont(FONT_MozillaText_Light, 10)},
         mainCO2AlertFont_{gfx::TrueTypeFontCache::getFont(FONT_MozillaText_SemiBold, 13)},
         subCO2AlertFont_{gfx::TrueTypeFontCache::getFont(FONT_MozillaText_SemiBold, 7)},
-        temperatureIndicatorFont_{gfx::TrueTypeFontCache::getFont(FONT_MozillaText_Light, 7)},
+        temperatureIndicatorFont_{gfx::TrueTypeFontCache::getFont(FONT_MozillaText_Light, 7)}
+    {
+        watch(co2Data_); // the alert appears as soon as the air quality changes
+    }
+
+    void MainClockView::refresh() {
+        AbstractMainClockView::refresh();
 
-        pictoBell_{"assets/pictograms/bell.png"},
-        pictoBellFilled_{"assets/pictograms/bell-filled.png"},
-        pictoBellSnooze_{"assets/pictograms/bell-snooze.png"},
-        pictoBellSlash_{"assets/pictograms/bell-slash.png"}
-    {}
+        co2Values_ = co2Data_.snapshot();
+    }
 
-    void MainClockView::render(RenderType& renderer) const {
-        drawClock(renderer);
-        auto alarmStatusBounds = drawAlarmStatus(renderer);
+    void MainClockView::render(RenderType& renderer, std::pmr::memory_resource* frameMemory) const {
+        drawClock(renderer, frameMemory);
+        auto alarmStatusBounds = drawAlarmStatus(renderer, frameMemory);
         drawCo2Alert(renderer, alarmStatusBounds);
-        drawConditions(renderer);
+        drawConditions(renderer, frameMemory);
     }
 
-    void MainClockView::drawClock(RenderType& renderer) const {
+    void MainClockView::drawClock(RenderType& renderer, std::pmr::memory_resource* frameMemory) const {
         auto middleY = renderer.getHeight() / 2;
 
         auto HMDimensions = renderer.drawText(
             0, middleY,
-            currentTime_.toString(false),
-            mainClockDigitFont_,
-            gfx::Canvas::Anchor::MiddleLeft
+            utils::formatTime(currentTime_, true, false, frameMemory),
+            mainClockDigits_,
+            RenderType::Anchor::MiddleLeft
         );
 
         auto secondsY = middleY + (HMDimensions.height / 2) - 1; // -1 to align the seconds digits with the baseline of the clock digits
         renderer.drawText(
             HMDimensions.width, secondsY,
-            utils::formatInt(currentTime_.second(), 2),
-            secondClockDigitFont_,
-            gfx::Canvas::Anchor::BottomLeft
+            utils::formatInt(currentTime_.second(), 2, frameMemory),
+            secondClockDigits_,
+            RenderType::Anchor::BottomLeft
         );
     }
 
-    MainClockView::AlarmStatusBounds MainClockView::drawAlarmStatus(RenderType& renderer) const {
+    MainClockView::AlarmStatusBounds MainClockView::drawAlarmStatus(RenderType& renderer, std::pmr::memory_resource* frameMemory) const {
         auto rightBorder = renderer.getWidth() - listElementBorderHorizontalSpacing_;
         auto topY = listElementBorderScreenVerticalSpacing_;
         size_t snoozeOffset {0}; // width of the potential snooze until text
         auto statusFont = rightListFont_;
 
-        std::string statusText = getAlarmStatus();
+        std::pmr::string statusText = getAlarmStatus(frameMemory);
 
         if (!hasAlarmEnabled_)
             statusFont = noAlarmFont_; // text overlaps with clock digits with rightListFont
 
         if (alarmStateData_.isAlarmSnoozed()) {
             // first draw snooze until time if snooze is active
+            std::pmr::string snoozeUntilText{"(", frameMemory};
+            snoozeUntilText.append(utils::formatTime(*alarmStateData_.getSnoozeUntil(), true, true, frameMemory)).push_back(')');
 
             auto snoozeUntilDimensions = renderer.drawText(
                 rightBorder, topY + (3/2), // 3/2 to center the snooze until text vertically
-                '(' + alarmStateData_.getSnoozeUntil()->toString() + ')',
+                snoozeUntilText,
                 snoozeUntilFont_,
-                gfx::Canvas::Anchor::TopRight
+                RenderType::Anchor::TopRight
             );
             snoozeOffset = snoozeUntilDimensions.width + snoozeStatusSnoozeUntilSpacing_;
         }
@@ -91,57 +96,53 @@ namespace PiAlarm::view::ssd1322 {
             rightBorder - snoozeOffset, topY,
             statusText,
             statusFont,
-            gfx::Canvas::Anchor::TopRight
+            RenderType::Anchor::TopRight
         );
 
         // draw the pictogram representing the status
-        auto pictogram = getAlarmStatusPictogram();
+        const auto& pictogram = getAlarmStatusPictogram();
         auto pictogramX = rightBorder - (snoozeOffset + statusTextDimensions.width + pictogram.getWidth() + pictogramStatusSpacing_);
         auto pictogramY = topY + (statusTextDimensions.height / 2) - (pictogram.getHeight() / 2) + 1; // +2 to align bottom of the clock with the baseline
 
-        auto savedDrawMode = renderer.getDrawMode();
-        renderer.setDrawMode(gfx::Canvas::DrawMode::Invert); // Pictograms files are black on white background
-
-        renderer.drawPictogram(pictogramX, pictogramY, pictogram);
-
-        renderer.setDrawMode(savedDrawMode);
+        renderer.drawSprite(pictogramX, pictogramY, pictogram); // inverted at build time, pictograms files are black on white background
 
         return {pictogramX, pictogramY + pictogram.getHeight()}; // return the bounding box of the alarm status area
     }
 
-    std::string MainClockView::getAlarmStatus() const {
+    std::pmr::string MainClockView::getAlarmStatus(std::pmr::memory_resource* memory) const {
         if (!hasAlarmEnabled_)
-            return "Pas d'alarme";
+            return {"Pas d'alarme", memory};
 
         if (!alarmStateData_.hasTriggeredAlarm())
-            return  nextAlarmTime_.toString(false);
+            return utils::formatTime(nextAlarmTime_, true, false, memory);
 
         if (alarmStateData_.isAlarmRinging())
-            return "DRIIIING !";
+            return {"DRIIIING !", memory};
 
         if (alarmStateData_.isAlarmSnoozed())
-            return "Snooze";
+            return {"Snooze", memory};
 
-        return "???";
+        return {"???", memory};
     }
 
-    const gfx::Pictogram& MainClockView::getAlarmStatusPictogram() const {
+    const gfx::Sprite& MainClockView::getAlarmStatusPictogram() const {
         if (!hasAlarmEnabled_)
-            return pictoBellSlash_;
+            return gfx::pictograms::bellSlash;
 
         if (alarmStateData_.isAlarmRinging())
-            return pictoBellFilled_;
+            return gfx::pictograms::bellFilled;
 
         if (alarmStateData_.isAlarmSnoozed())
-            return pictoBellSnooze_;
+            return gfx::pictograms::bellSnooze;
 
-        return pictoBell_;
+        return gfx::pictograms::bell;
     }
 
     void MainClockView::drawCo2Alert(RenderType& renderer, const AlarmStatusBounds& bounds) const {
-        if (!isAlertLevel(co2Data_.getAirQualityLevel()) || !co2Data_.isValid()) return;
+        const model::AirQualityLevel level {co2Values_.getAirQualityLevel()};
+        if (!isAlertLevel(level) || !co2Values_.valid) return;
 
-        if (co2Data_.getAirQualityLevel() == model::AirQualityLevel::VeryPoor
+        if (level == model::AirQualityLevel::VeryPoor
             && currentTime_.second() % 3 == 2)
                 return; // blink the alert every 3 seconds (2 on, 1 off)
 
@@ -152,14 +153,14 @@ namespace PiAlarm::view::ssd1322 {
             rightBorder, topY + mainCO2AlertFont_->getAscender(),
             "2",
             subCO2AlertFont_,
-            gfx::Canvas::Anchor::BottomRight
+            RenderType::Anchor::BottomRight
         );
 
         renderer.drawText(
             rightBorder - subTextDimensions.width, topY,
             "CO",
             mainCO2AlertFont_,
-            gfx::Canvas::Anchor::TopRight
+            RenderType::Anchor::TopRight
         );
     }
 
@@ -168,15 +169,15 @@ namespace PiAlarm::view::ssd1322 {
         return level == AirQualityLevel::Poor || level == AirQualityLevel::VeryPoor;
     }
 
-    void MainClockView::drawConditions(RenderType& renderer) const {
+    void MainClockView::drawConditions(RenderType& renderer, std::pmr::memory_resource* frameMemory) const {
         auto bottomY = renderer.getHeight() - listElementBorderScreenVerticalSpacing_;
 
         // draw outdoor condition
         auto outdoorTextHeight = drawSingleCondition(
             renderer,
             bottomY,
-            utils::formatTemperature(currentOutdoorTemperature_, currentWeatherDataValid_),
-            utils::formatHumidity(currentOutdoorHumidity_, currentWeatherDataValid_),
+            utils::formatTemperature(currentOutdoorTemperature_, currentWeatherDataValid_, frameMemory),
+            utils::formatHumidity(currentOutdoorHumidity_, currentWeatherDataValid_, frameMemory),
             "Ext."
         );
 
@@ -184,8 +185,8 @@ namespace PiAlarm::view::ssd1322 {
         drawSingleCondition(
             renderer,
             bottomY - (outdoorTextHeight + conditionVerticalSpacing_),
-            utils::formatTemperature(currentIndoorTemperature_, indoorDataValid_),
-            utils::formatHumidity(currentIndoorHumidity_, indoorDataValid_),
+            utils::formatTemperature(currentIndoorTemperature_, indoorDataValid_, frameMemory),
+            utils::formatHumidity(currentIndoorHumidity_, indoorDataValid_, frameMemory),
             "Int."
         );
     }
@@ -193,9 +194,9 @@ namespace PiAlarm::view::ssd1322 {
     ssize_t MainClockView::drawSingleCondition(
         RenderType& renderer,
         size_t baseline,
-        const std::string &temperatureText,
-        const std::string &humidityText,
-        const std::string &indicator) const
+        std::string_view temperatureText,
+        std::string_view humidityText,
+        std::string_view indicator) const
     {
         const auto rightBorder = renderer.getWidth() - listElementBorderHorizontalSpacing_;
 
@@ -205,7 +206,7 @@ namespace PiAlarm::view::ssd1322 {
             baseline,
             humidityText,
             rightListFont_,
-            gfx::Canvas::Anchor::BottomRight
+            RenderType::Anchor::BottomRight
         );
 
         // draw temperature at the left of the humidity
@@ -215,7 +216,7 @@ namespace PiAlarm::view::ssd1322 {
             baseline,
             temperatureText,
             rightListFont_,
-            gfx::Canvas::Anchor::BottomRight
+            RenderType::Anchor::BottomRight
         );
 
         // draw temperature indicator at the bottom left of the temperature
@@ -226,7 +227,7 @@ namespace PiAlarm::view::ssd1322 {
             baseline,
             indicator,
             temperatureIndicatorFont_,
-            gfx::Canvas::Anchor::BottomRight
+            RenderType::Anchor::BottomRight
         );
 
         return std::max(temperatureSize.height, humiditySize.height);
@@ -2,9 +2,10 @@
 
 #include "model/CO2Data.hpp"
 #include "view/AbstractMainClockView.h"
+#include "gfx/DigitSpriteSheet.h"
 #include "gfx/TrueTypeFont.h"
 #include "gfx/TrueTypeFontCache.h"
-#include "gfx/Pictogram.h"
+#include "gfx/Pictograms.h"
 
 /**
  * @namespace PiAlarm::view::ssd1322
@@ -23,9 +24,10 @@ namespace PiAlarm::view::ssd1322 {
      */
     class MainClockView final : public AbstractMainClockView {
         const model::CO2Data& co2Data_; ///< Reference to the CO2 data model, used for displaying air quality alert.
+        model::CO2Values co2Values_; ///< CO2 values read at the last refresh
 
-        const std::shared_ptr<gfx::IFont> mainClockDigitFont_;       ///< Font for the main clock digits.
-        const std::shared_ptr<gfx::IFont> secondClockDigitFont_;     ///< Font for the seconds in the clock.
+        const gfx::DigitSpriteSheet mainClockDigits_;                ///< Pre-rendered digits for the main clock (hours and minutes).
+        const gfx::DigitSpriteSheet secondClockDigits_;              ///< Pre-rendered digits for the seconds in the clock.
         const std::shared_ptr<gfx::IFont> rightListFont_;            ///< Font for the right list elements (alarm & conditions).
         const std::shared_ptr<gfx::IFont> noAlarmFont_;              ///< Font for displaying "No Alarm" text.
         const std::shared_ptr<gfx::IFont> snoozeUntilFont_;          ///< Font for displaying the snooze until time.
@@ -33,11 +35,6 @@ namespace PiAlarm::view::ssd1322 {
         const std::shared_ptr<gfx::IFont> subCO2AlertFont_;          ///< Font for displaying the sub CO2 alert text.
         const std::shared_ptr<gfx::IFont> temperatureIndicatorFont_; ///< Font for the temperature indicator.
 
-        const gfx::Pictogram pictoBell_;                              ///< Pictogram for the bell icon, used when indicating the next alarm.
-        const gfx::Pictogram pictoBellFilled_;                        ///< Pictogram for the filled bell icon, used when an alarm is ringing.
-        const gfx::Pictogram pictoBellSnooze_;                        ///< Pictogram for the snooze bell icon, used when an alarm is snoozed.
-        const gfx::Pictogram pictoBellSlash_;                         ///< Pictogram for the bell slash icon, used when an alarm is disabled.
-
         const ssize_t temperatureHumiditySpacing_ {5};                ///< Spacing between temperature and humidity text.
         const ssize_t indicatorTemperatureSpacing_ {1};               ///< Spacing between temperature and indicator text.
         const ssize_t listElementBorderScreenVerticalSpacing_ {7};    ///< Vertical spacing for list elements from the screen border.
@@ -82,12 +79,18 @@ namespace PiAlarm::view::ssd1322 {
          */
         ~MainClockView() override = default;
 
+        /**
+         * @brief Refreshes the view by updating the state variables, including the CO2 values.
+         */
+        void refresh() override;
+
         /**
          * @brief Renders the view using the provided renderer.
          * This method draws the current time, alarm information, and weather data on the screen.
          * @param renderer The renderer used to draw the view.
+         * @param frameMemory The memory resource to allocate the render temporaries from.
          */
-        void render(RenderType& renderer) const override;
+        void render(RenderType& renderer, std::pmr::memory_resource* frameMemory) const override;
 
     private:
 
@@ -95,26 +98,29 @@ namespace PiAlarm::view::ssd1322 {
          * @brief Draws the clock on the screen.
          * This method is responsible for rendering the current time in a specific format.
          * @param renderer The renderer used to draw the clock.
+         * @param frameMemory The memory resource to allocate the render temporaries from.
          */
-        void drawClock(RenderType& renderer) const;
+        void drawClock(RenderType& renderer, std::pmr::memory_resource* frameMemory) const;
 
         /**
          * @brief Draws the alarm status on the screen.
          * This method displays the current alarm status, including whether the alarm is active,
          * snoozed, or disabled. It also handles the display of snooze until time if applicable.
          * @param renderer The renderer used to draw the alarm status.
+         * @param frameMemory The memory resource to allocate the render temporaries from.
          * @return The bounding box of the alarm status area.
          */
-        AlarmStatusBounds drawAlarmStatus(RenderType& renderer) const;
+        AlarmStatusBounds drawAlarmStatus(RenderType& renderer, std::pmr::memory_resource* frameMemory) const;
 
         /**
          * @brief Gets the current alarm status as a string.
          * This method checks the alarm state and returns a string representation of the current
          * alarm status, such as "No Alarm", "Alarm Active", or "Alarm Snoozed".
+         * @param memory The memory resource used to allocate the returned string.
          * @return A string representing the current alarm status.
          */
         [[nodiscard]]
-        std::string getAlarmStatus() const;
+        std::pmr::string getAlarmStatus(std::pmr::memory_resource* memory) const;
 
         /**
          * @brief Gets the pictogram representing the current alarm status.
@@ -123,14 +129,14 @@ namespace PiAlarm::view::ssd1322 {
          * @return A reference to the pictogram representing the current alarm status.const
          */
         [[nodiscard]]
-        const gfx::Pictogram& getAlarmStatusPictogram() const;
+        const gfx::Sprite& getAlarmStatusPictogram() const;
 
         /**
          * @brief Draws the CO2 alert on the screen if the CO2 level exceeds a certain threshold.
          * This method checks the air quality level and renders an alert on the screen if the CO2 level is above the defined threshold, indicating poor air quality.
          * @param renderer The renderer used to draw the alert.
          * @param bounds The bounding box of the alarm status, used for positioning the CO2 alert.
-         * @see model::CO2Data::getAirQualityLevel() for determining the air quality level.
+         * @see model::CO2Values::getAirQualityLevel() for determining the air quality level.
          */
         void drawCo2Alert(RenderType& renderer, const AlarmStatusBounds& bounds) const;
 
@@ -147,8 +153,9 @@ namespace PiAlarm::view::ssd1322 {
          * This method is responsible for rendering the indoor and outdoor temperature and humidity
          * conditions at the bottom right of the screen.
          * @param renderer The renderer used to draw the conditions.
+         * @param frameMemory The memory resource to allocate the render temporaries from.
          */
-        void drawConditions(RenderType& renderer) const;
+        void drawConditions(RenderType& renderer, std::pmr::memory_resource* frameMemory) const;
 
         /**
          * @brief Draws the condition (temperature, humidity, and indicator) on the screen.
@@ -165,9 +172,9 @@ namespace PiAlarm::view::ssd1322 {
         ssize_t drawSingleCondition(
             RenderType& renderer,
             size_t baseline,
-            const std::string &temperatureText,
-            const std::string &humidityText,
-            const std::string &indicator
+            std::string_view temperatureText,
+            std::string_view humidityText,
+            std::string_view indicator
         ) const;
     };
 
@@ -0,0 +1,149 @@
+#include "common/InputLatencyTracer.h"
+#include "controller/AlarmController.h"
+#include "display/ViewOutputConfig.h"
+#include "gfx/SDD1322Buffer.h"
+#include "input/InputScript.h"
+#include "input/InputWorker.h"
+#include "input/ReplayInputSource.h"
+#include "model/AlarmsData.hpp"
+#include "model/ClockData.hpp"
+#include "model/manager/AlarmManager.h"
+#include "system/EventLoop.h"
+#include "view/manager/ViewManager.h"
+#include "view/ssd1322/AlarmsSettingsView.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+namespace {
+
+    using namespace PiAlarm;
+    using std::chrono::milliseconds;
+
+    /**
+     * Builds an alarm editing session: enter the settings view, set the hour of each alarm with a held button
+     * (auto-repeats every 100 ms after 500 ms), step the minutes, toggle the activation and confirm.
+     */
+    std::vector<input::ScriptedInput> makeDefaultScript() {
+        std::vector<input::ScriptedInput> script;
+        milliseconds time {500};
+
+        auto tap = [&](input::ButtonId button) {
+            script.push_back({time, button, true});
+            script.push_back({time + milliseconds{80}, button, false});
+            time += milliseconds{250};
+        };
+        auto hold = [&](input::ButtonId button, size_t repeats) {
+            script.push_back({time, button, true});
+            for (size_t i {0}; i < repeats; ++i) {
+                script.push_back({time + milliseconds{500 + 100 * i}, button, true});
+            }
+            time += milliseconds{500 + 100 * repeats};
+            script.push_back({time, button, false});
+            time += milliseconds{250};
+        };
+
+        tap(input::ButtonId::Main); // take control of the view
+
+        for (size_t alarm {0}; alarm < 3; ++alarm) {
+            tap(input::ButtonId::Main); // edit the hour
+            hold(input::ButtonId::Next, 6);
+            tap(input::ButtonId::Main); // edit the minutes
+            for (size_t i {0}; i < 5; ++i) tap(input::ButtonId::Next);
+            tap(input::ButtonId::Main); // edit the activation
+            tap(input::ButtonId::Next);
+            tap(input::ButtonId::Main); // save the alarm
+            tap(input::ButtonId::Next); // next alarm
+        }
+
+        tap(input::ButtonId::Back); // leave the view
+        return script;
+    }
+
+} // namespace
+
+// This benchmark replays an alarm editing session through the view manager and the alarm settings view,
+// rendered into a headless screen: no button nor display is needed (build with DISPLAY_SSD1322 and DISPLAY_HEADLESS).
+// Usage: Input_replay_benchmark [script] [simulated SPI rate in Hz]
+// The script is a session recorded with --record-input, a built-in session is replayed without it.
+// It reports the latency of the inputs at each stage, from their scheduled time to the end of the flush.
+int main(int argc, char* argv[]) {
+    try {
+        auto script = argc > 1 ? input::InputScript::load(argv[1]) : makeDefaultScript();
+        const uint32_t simulatedSpeed = argc > 2 ? static_cast<uint32_t>(std::strtoul(argv[2], nullptr, 10)) : 10'000'000;
+
+        // models and controller
+        model::ClockData clockData{};
+        model::AlarmsData alarmsData{3};
+        model::manager::AlarmManager alarmManager{clockData, alarmsData};
+        controller::AlarmController alarmController{alarmsData, alarmManager};
+
+        // display
+        RenderType renderer{std::make_unique<gfx::SDD1322Buffer>()};
+        ScreenType screen{simulatedSpeed};
+        common::InputLatencyTracer inputLatency;
+        view::ViewManager viewManager{screen, renderer, inputLatency};
+        viewManager.addView(std::make_unique<view::ssd1322::AlarmsSettingsView>(alarmsData, alarmController));
+
+        // input
+        const size_t inputCount {script.size()};
+        input::ReplayInputSource inputSource{std::move(script)};
+        system::EventLoop eventLoop;
+        input::InputWorker inputWorker{inputSource, eventLoop};
+        alarmsData.addObserver(&eventLoop);
+
+        viewManager.start();
+        inputSource.init();
+        inputWorker.startWorker();
+        const auto start = std::chrono::steady_clock::now();
+
+        // Same loop as Application::run, until every input was handled or dropped
+        size_t handledCount {0};
+        while (handledCount + inputWorker.getDroppedEvents() < inputCount) {
+            handledCount += inputWorker.drainEvents([&](const input::InputEvent& event) {
+                inputLatency.record(common::InputLatencyTracer::Stage::Dispatched, event.timestamp);
+                viewManager.handleInputEvent(event);
+            });
+            viewManager.refresh();
+            eventLoop.wait();
+        }
+        viewManager.refresh();
+
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+        inputWorker.stop();
+        viewManager.stop();
+
+        using Milliseconds = std::chrono::duration<double, std::milli>;
+        std::cout << "Session replayed in " << Milliseconds{elapsed}.count() << " ms, SPI rate simulated at "
+                  << simulatedSpeed << " Hz" << std::endl;
+        std::cout << "  Inputs handled: " << handledCount << ", dropped: " << inputWorker.getDroppedEvents() << std::endl;
+        std::cout << "  Frames flushed: " << viewManager.getFlushStats().flushed
+                  << ", skipped: " << viewManager.getFlushStats().skipped << std::endl;
+
+        const auto& timing = screen.getFlushTiming();
+        if (timing.flushes > 0) {
+            std::cout << "  Screen flushes: " << timing.flushes << ", average "
+                      << Milliseconds{timing.total}.count() / timing.flushes << " ms, "
+                      << static_cast<double>(timing.bytes) / timing.flushes << " bytes" << std::endl;
+        }
+
+        for (size_t i {0}; i < common::InputLatencyTracer::STAGE_COUNT; ++i) {
+            const auto stage = static_cast<common::InputLatencyTracer::Stage>(i);
+            const auto summary = inputLatency.getHistogram(stage).summarize();
+
+            std::cout << "  Input to " << common::InputLatencyTracer::getStageName(stage) << ": "
+                      << summary.count << " inputs, p50 " << Milliseconds{summary.p50}.count()
+                      << " ms, p95 " << Milliseconds{summary.p95}.count()
+                      << " ms, p99 " << Milliseconds{summary.p99}.count()
+                      << " ms, max " << Milliseconds{summary.max}.count() << " ms" << std::endl;
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "Benchmark failed: " << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,110 @@
+#include "gfx/BasicCanvas.h"
+#include "gfx/DigitSpriteSheet.h"
+#include "gfx/SDD1322Buffer.h"
+#include "gfx/TrueTypeFontCache.h"
+#include "gfx/Pictograms.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+
+// Count every heap allocation made by the program
+namespace {
+    std::atomic<size_t> allocationCount {0};
+}
+
+void* operator new(std::size_t size) {
+    ++allocationCount;
+    if (void* ptr = std::malloc(size ? size : 1)) return ptr;
+    throw std::bad_alloc{};
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+// This is a simple benchmark rendering a frame similar to the main clock screen, without any display.
+// It reports the time and the number of heap allocations per frame once the caches are warm,
+// with the frame drawn directly and with the frame recorded then replayed (only the seconds are redrawn).
+int main() {
+    using namespace PiAlarm;
+    using Canvas = gfx::BasicCanvas<gfx::SDD1322Buffer>;
+
+    constexpr size_t WARMUP_FRAMES {60};
+    constexpr size_t MEASURED_FRAMES {600};
+
+    Canvas canvas{std::make_unique<gfx::SDD1322Buffer>()};
+
+    const gfx::DigitSpriteSheet clockDigits{gfx::TrueTypeFontCache::getFont(FONT_MozillaText_Light, 48)};
+    const gfx::DigitSpriteSheet secondsDigits{gfx::TrueTypeFontCache::getFont(FONT_MozillaText_Light, 18)};
+    auto listFont = gfx::TrueTypeFontCache::getFont(FONT_MozillaText_Light, 13);
+    auto indicatorFont = gfx::TrueTypeFontCache::getFont(FONT_MozillaText_Light, 7);
+    const auto& bell = gfx::pictograms::bell;
+
+    // Seconds texts, prepared before the measure
+    std::array<std::array<char, 3>, 60> seconds {};
+    for (size_t s {0}; s < seconds.size(); ++s) {
+        seconds[s] = {static_cast<char>('0' + s / 10), static_cast<char>('0' + s % 10), '\0'};
+    }
+
+    auto renderFrame = [&](size_t frame) {
+        canvas.clear();
+
+        auto clock = canvas.drawText(0, 32, "12:34", clockDigits, Canvas::Anchor::MiddleLeft);
+        canvas.drawText(clock.width, 32 + clock.height / 2 - 1, seconds[frame % 60].data(), secondsDigits, Canvas::Anchor::BottomLeft);
+
+        auto status = canvas.drawText(253, 2, "07:30", listFont, Canvas::Anchor::TopRight);
+        canvas.drawSprite(253 - status.width - bell.getWidth() - 4, 2, bell);
+
+        auto humidity = canvas.drawText(253, 61, "45%", listFont, Canvas::Anchor::BottomRight);
+        auto temperature = canvas.drawText(253 - humidity.width - 6, 61, "12.5°", listFont, Canvas::Anchor::BottomRight);
+        canvas.drawText(253 - humidity.width - temperature.width - 9, 61, "Ext.", indicatorFont, Canvas::Anchor::BottomRight);
+
+        humidity = canvas.drawText(253, 44, "52%", listFont, Canvas::Anchor::BottomRight);
+        temperature = canvas.drawText(253 - humidity.width - 6, 44, "21.3°", listFont, Canvas::Anchor::BottomRight);
+        canvas.drawText(253 - humidity.width - temperature.width - 9, 44, "Int.", indicatorFont, Canvas::Anchor::BottomRight);
+    };
+
+    // Measures the frames drawn directly, then recorded and replayed as the view manager does
+    bool allocationFree {true};
+
+    for (bool recording : {false, true}) {
+        canvas.setRecording(recording);
+
+        auto drawFrame = [&](size_t frame) {
+            renderFrame(frame);
+            canvas.replay();
+        };
+
+        for (size_t frame {0}; frame < WARMUP_FRAMES; ++frame) {
+            drawFrame(frame);
+        }
+
+        const size_t allocationsBefore = allocationCount;
+        const auto start = std::chrono::steady_clock::now();
+
+        for (size_t frame {0}; frame < MEASURED_FRAMES; ++frame) {
+            drawFrame(frame);
+        }
+
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+        const size_t allocations = allocationCount - allocationsBefore;
+        allocationFree = allocationFree && allocations == 0;
+
+        std::cout << (recording ? "Recorded and replayed" : "Drawn directly") << std::endl;
+        std::cout << "  Frames rendered: " << MEASURED_FRAMES << std::endl;
+        std::cout << "  Average frame time: "
+                  << std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count() / MEASURED_FRAMES / 1000.0
+                  << " us" << std::endl;
+        std::cout << "  Heap allocations per frame: " << static_cast<double>(allocations) / MEASURED_FRAMES << std::endl;
+    }
+
+    return allocationFree ? EXIT_SUCCESS : EXIT_FAILURE;
+}
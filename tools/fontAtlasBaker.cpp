@@ -0,0 +1,135 @@
+#include <ft2build.h>
+#include FT_FREETYPE_H
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "gfx/FontAtlas.h"
+
+// Builds a font atlas (see gfx/FontAtlas.h) from a TrueType font, at one pixel size.
+// Usage: FontAtlasBaker <font.ttf> <pixel height> <output.atlas>
+//
+// The atlas holds the printable ASCII and Latin-1 characters available in the font,
+// which covers every text displayed by the application.
+namespace {
+
+    struct CodepointRange {
+        uint32_t first;
+        uint32_t last;
+    };
+
+    constexpr CodepointRange BAKED_RANGES[] {
+        {0x20, 0x7E}, // printable ASCII
+        {0xA0, 0xFF}, // Latin-1 supplement (accents, degree sign...)
+    };
+
+    template<typename T>
+    void writeRaw(std::ofstream& out, const T& value) {
+        out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    namespace atlas = PiAlarm::gfx::atlas;
+
+    if (argc != 4) {
+        std::cerr << "Usage: " << argv[0] << " <font.ttf> <pixel height> <output.atlas>" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    const std::string fontPath {argv[1]};
+    const int pixelHeight {std::atoi(argv[2])};
+    const std::string outputPath {argv[3]};
+
+    if (pixelHeight <= 0) {
+        std::cerr << "Invalid pixel height: " << argv[2] << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    FT_Library library;
+    FT_Face face;
+
+    if (FT_Init_FreeType(&library)) {
+        std::cerr << "Error initializing FreeType library" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    if (FT_New_Face(library, fontPath.c_str(), 0, &face) || FT_Set_Pixel_Sizes(face, 0, pixelHeight)) {
+        std::cerr << "Unable to load font: " << fontPath << std::endl;
+        FT_Done_FreeType(library);
+        return EXIT_FAILURE;
+    }
+
+    std::vector<atlas::GlyphEntry> glyphTable;
+    std::vector<uint8_t> bitmapData;
+
+    // glyphs are rendered the same way as TrueTypeFont does at runtime
+    for (const auto& range : BAKED_RANGES) {
+        for (uint32_t codepoint {range.first}; codepoint <= range.last; ++codepoint) {
+            if (FT_Get_Char_Index(face, codepoint) == 0) continue; // not in the font
+            if (FT_Load_Char(face, codepoint, FT_LOAD_RENDER)) {
+                std::cerr << "Error when loading character. Codepoint = " << codepoint << std::endl;
+                continue;
+            }
+
+            FT_GlyphSlot g = face->glyph;
+            FT_Bitmap& bmp = g->bitmap;
+
+            glyphTable.push_back({
+                codepoint,
+                static_cast<int16_t>(g->bitmap_left),
+                static_cast<int16_t>(g->bitmap_top),
+                static_cast<int16_t>(g->advance.x >> 6),
+                static_cast<uint16_t>(bmp.width),
+                static_cast<uint16_t>(bmp.rows),
+                0,
+                static_cast<uint32_t>(bitmapData.size())
+            });
+
+            // copy rows without the FreeType pitch padding
+            for (size_t y = 0; y < bmp.rows; ++y) {
+                const auto* row = bmp.buffer + y * bmp.pitch;
+                bitmapData.insert(bitmapData.end(), row, row + bmp.width);
+            }
+        }
+    }
+
+    atlas::Header header {};
+    header.magic = atlas::MAGIC;
+    header.version = atlas::VERSION;
+    header.pixelHeight = pixelHeight;
+    header.ascender = static_cast<int32_t>(face->size->metrics.ascender >> 6);
+    header.descender = static_cast<int32_t>(face->size->metrics.descender >> 6);
+    header.lineHeight = static_cast<int32_t>(face->size->metrics.height >> 6);
+    header.glyphCount = static_cast<uint32_t>(glyphTable.size());
+    header.glyphTableOffset = sizeof(atlas::Header);
+    header.bitmapDataOffset = static_cast<uint32_t>(sizeof(atlas::Header) + glyphTable.size() * sizeof(atlas::GlyphEntry));
+    header.bitmapDataSize = static_cast<uint32_t>(bitmapData.size());
+
+    FT_Done_Face(face);
+    FT_Done_FreeType(library);
+
+    std::ofstream out{outputPath, std::ios::binary | std::ios::trunc};
+    if (!out) {
+        std::cerr << "Unable to write font atlas: " << outputPath << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    writeRaw(out, header);
+    for (const auto& entry : glyphTable) {
+        writeRaw(out, entry);
+    }
+    out.write(reinterpret_cast<const char*>(bitmapData.data()), static_cast<std::streamsize>(bitmapData.size()));
+
+    if (!out) {
+        std::cerr << "Unable to write font atlas: " << outputPath << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::cout << "Baked " << glyphTable.size() << " glyphs (" << bitmapData.size() << " bytes) into " << outputPath << std::endl;
+    return EXIT_SUCCESS;
+}
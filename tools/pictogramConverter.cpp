@@ -0,0 +1,134 @@
+#include <cctype>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "lodepng.h"
+
+// Converts PNG pictograms into packed 4-bit sprites (see gfx/Sprite.h), written as constexpr data in a C++ header.
+// Usage: PictogramConverter <output.h> <pictogram.png>...
+//
+// Pictogram files are black on a white background. The conversion does once what drawing the PNG with
+// DrawMode::Invert did on every frame: white (or transparent) pixels become transparent,
+// the others are inverted and quantized to 4 bits.
+namespace {
+
+    struct ConvertedSprite {
+        std::string name;
+        unsigned width;
+        unsigned height;
+        std::vector<uint8_t> pixels;
+        std::vector<uint8_t> mask;
+    };
+
+    uint8_t rgbToGray(uint8_t r, uint8_t g, uint8_t b) {
+        return static_cast<uint8_t>(0.299 * r + 0.587 * g + 0.114 * b);
+    }
+
+    // "bell-filled.png" gives "bellFilled"
+    std::string makeIdentifier(const std::filesystem::path& path) {
+        std::string identifier;
+        bool upperNext {false};
+
+        for (char c : path.stem().string()) {
+            if (c == '-' || c == '_' || c == ' ') {
+                upperNext = !identifier.empty();
+                continue;
+            }
+            identifier += upperNext ? static_cast<char>(std::toupper(static_cast<unsigned char>(c))) : c;
+            upperNext = false;
+        }
+
+        return identifier;
+    }
+
+    ConvertedSprite convert(const std::filesystem::path& path) {
+        std::vector<uint8_t> image;
+        unsigned width, height;
+
+        auto error = lodepng::decode(image, width, height, path.string());
+        if (error) {
+            throw std::runtime_error("Failed to load PNG image: " + path.string() + " - " + lodepng_error_text(error));
+        }
+
+        ConvertedSprite sprite{makeIdentifier(path), width, height, {}, {}};
+        const size_t rowBytes = (width + 1) / 2;
+        sprite.pixels.resize(rowBytes * height, 0);
+        sprite.mask.resize(rowBytes * height, 0);
+
+        for (size_t y = 0; y < height; ++y) {
+            for (size_t x = 0; x < width; ++x) {
+                size_t index = (y * width + x) * 4; // RGBA
+                uint8_t gray = rgbToGray(image[index], image[index + 1], image[index + 2]);
+                bool opaque = image[index + 3] >= 128 && gray != 255;
+
+                if (!opaque) continue;
+
+                const uint8_t value = (255 - gray) / 16;
+                const int shift = (x % 2 == 0) ? 4 : 0; // even column in the high nibble
+                sprite.pixels[y * rowBytes + x / 2] |= value << shift;
+                sprite.mask[y * rowBytes + x / 2] |= 0x0F << shift;
+            }
+        }
+
+        return sprite;
+    }
+
+    void writeArray(std::ostream& out, const std::string& name, const std::vector<uint8_t>& data) {
+        out << "    inline constexpr uint8_t " << name << "[] {";
+        for (size_t i = 0; i < data.size(); ++i) {
+            out << (i % 16 == 0 ? "\n        " : " ")
+                << "0x" << std::hex << std::setw(2) << std::setfill('0') << static_cast<int>(data[i]) << std::dec << ",";
+        }
+        out << "\n    };\n";
+    }
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    if (argc < 3) {
+        std::cerr << "Usage: " << argv[0] << " <output.h> <pictogram.png>..." << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::ostringstream out;
+    out << "#pragma once\n\n"
+        << "// Generated by PictogramConverter from assets/pictograms, do not edit.\n\n"
+        << "#include <cstdint>\n\n"
+        << "#include \"gfx/Sprite.h\"\n\n"
+        << "namespace PiAlarm::gfx::pictograms {\n";
+
+    try {
+        for (int i = 2; i < argc; ++i) {
+            const auto sprite = convert(argv[i]);
+
+            out << "\n";
+            writeArray(out, sprite.name + "Pixels", sprite.pixels);
+            writeArray(out, sprite.name + "Mask", sprite.mask);
+            out << "    inline constexpr Sprite " << sprite.name << " {"
+                << sprite.width << ", " << sprite.height << ", "
+                << sprite.name << "Pixels, " << sprite.name << "Mask};\n";
+        }
+    }
+    catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    out << "\n} // namespace PiAlarm::gfx::pictograms\n";
+
+    const std::string outputPath {argv[1]};
+    std::ofstream file{outputPath, std::ios::binary | std::ios::trunc};
+    file << out.str();
+    if (!file) {
+        std::cerr << "Unable to write sprites header: " << outputPath << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}